@@ -0,0 +1,195 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+#pragma once
+
+//NOTE: A small LZ77 byte codec in the spirit of the LZ4 block format, shared by the game and
+//		the AssetPackBuilder tool. A stream is a list of sequences, each a token byte with the
+//		literal count in the high and the match length minus AssetMinimumMatch in the low
+//		nibble, followed by extra length bytes for nibbles of 15, the literals, a 16 bit
+//		little endian offset back into the output and extra match length bytes. The last
+//		sequence carries literals only. Decoding is a plain copy loop, fast enough to be
+//		done at load time.
+namespace WinGame {
+	namespace Content {
+		const std::uint32_t AssetMinimumMatch	= 4U;
+		const std::uint32_t AssetMaximumOffset	= 65535U;
+		const std::uint32_t AssetHashBits		= 14U;
+
+		namespace Detail {
+			inline std::uint32_t ReadSequence( const std::uint8_t *data ) {
+				std::uint32_t value;
+				std::memcpy( &value, data, sizeof( value ) );
+				return value;
+			}//ReadSequence()
+
+			inline void WriteLength( std::vector<std::uint8_t> &output, std::size_t length ) {
+				for ( ; length >= 255; length -= 255 ) {
+					output.push_back( 255 );
+				}
+
+				output.push_back( static_cast<std::uint8_t>( length ) );
+			}//WriteLength()
+
+			inline void WriteSequence( std::vector<std::uint8_t> &output, const std::uint8_t *literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength ) {
+				std::size_t	match	= matchLength > 0 ? matchLength - AssetMinimumMatch : 0;
+				auto		token	= static_cast<std::uint8_t>( ( std::min<std::size_t>( literalCount, 15 ) << 4 ) | std::min<std::size_t>( match, 15 ) );
+
+				output.push_back( token );
+
+				if ( literalCount >= 15 ) {
+					WriteLength( output, literalCount - 15 );
+				}
+
+				output.insert( output.end(), literals, literals + literalCount );
+
+				if ( matchLength == 0 ) {
+					return;
+				}
+
+				output.push_back( static_cast<std::uint8_t>( offset & 0xFF ) );
+				output.push_back( static_cast<std::uint8_t>( offset >> 8 ) );
+
+				if ( match >= 15 ) {
+					WriteLength( output, match - 15 );
+				}
+			}//WriteSequence()
+
+			//Returns false if the length runs past the end of the input
+			inline bool ReadLength( const std::uint8_t *&input, const std::uint8_t *end, std::size_t &length ) {
+				std::uint8_t next;
+
+				do {
+					if ( input == end ) {
+						return false;
+					}
+
+					next	= *input++;
+					length	+= next;
+				} while ( next == 255 );
+
+				return true;
+			}//ReadLength()
+
+		}//Detail namespace
+
+		//Greedy single pass with one hash table entry per bucket, the tool calls it once per asset
+		inline void CompressAsset( const std::uint8_t *source, std::size_t size, std::vector<std::uint8_t> &output ) {
+			output.clear();
+			output.reserve( size + size / 255 + 16 );
+
+			std::vector<std::size_t>	table( 1U << AssetHashBits, ~std::size_t( 0 ) );
+			std::size_t					anchor		= 0;
+			std::size_t					position	= 0;
+
+			//The tail always goes out as literals, so matches never have to check the end
+			const std::size_t limit = size > 12 ? size - 12 : 0;
+
+			while ( position < limit ) {
+				auto sequence	= Detail::ReadSequence( source + position );
+				auto hash		= ( sequence * 2654435761U ) >> ( 32 - AssetHashBits );
+				auto candidate	= table[hash];
+
+				table[hash] = position;
+
+				if ( candidate == ~std::size_t( 0 ) || position - candidate > AssetMaximumOffset || Detail::ReadSequence( source + candidate ) != sequence ) {
+					++position;
+					continue;
+				}
+
+				std::size_t length = AssetMinimumMatch;
+
+				while ( position + length < size - 5 && source[candidate + length] == source[position + length] ) {
+					++length;
+				}
+
+				Detail::WriteSequence( output, source + anchor, position - anchor, position - candidate, length );
+
+				position	+= length;
+				anchor		= position;
+			}
+
+			Detail::WriteSequence( output, source + anchor, size - anchor, 0, 0 );
+		}//CompressAsset()
+
+		//Returns false unless the input is well formed and fills exactly targetSize bytes
+		inline bool DecompressAsset( const std::uint8_t *source, std::size_t sourceSize, std::uint8_t *target, std::size_t targetSize ) {
+			const std::uint8_t	*input		= source;
+			const std::uint8_t	*inputEnd	= source + sourceSize;
+			std::uint8_t		*output		= target;
+			std::uint8_t		*outputEnd	= target + targetSize;
+
+			while ( input < inputEnd ) {
+				std::uint8_t	token			= *input++;
+				std::size_t		literalCount	= token >> 4;
+
+				if ( literalCount == 15 && !Detail::ReadLength( input, inputEnd, literalCount ) ) {
+					return false;
+				}
+
+				if ( literalCount > static_cast<std::size_t>( inputEnd - input ) || literalCount > static_cast<std::size_t>( outputEnd - output ) ) {
+					return false;
+				}
+
+				std::memcpy( output, input, literalCount );
+				input	+= literalCount;
+				output	+= literalCount;
+
+				//Only the last sequence ends after its literals
+				if ( input == inputEnd ) {
+					break;
+				}
+
+				if ( inputEnd - input < 2 ) {
+					return false;
+				}
+
+				std::size_t offset = input[0] | ( static_cast<std::size_t>( input[1] ) << 8 );
+				input += 2;
+
+				std::size_t length = token & 0xF;
+
+				if ( length == 15 && !Detail::ReadLength( input, inputEnd, length ) ) {
+					return false;
+				}
+
+				length += AssetMinimumMatch;
+
+				if ( offset == 0 || offset > static_cast<std::size_t>( output - target ) || length > static_cast<std::size_t>( outputEnd - output ) ) {
+					return false;
+				}
+
+				//Byte by byte, a match may overlap the bytes it produces
+				const std::uint8_t *match = output - offset;
+
+				for ( std::size_t i = 0; i < length; ++i ) {
+					output[i] = match[i];
+				}
+
+				output += length;
+			}
+
+			return output == outputEnd;
+		}//DecompressAsset()
+
+	}//Content namespace
+}//WinGame namespace
@@ -0,0 +1,191 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+#include "pch.h"
+#include "AssetPack.h"
+#include "AssetCompression.h"
+#include "MappedFile.h"
+
+using namespace WinGame;
+using namespace WinGame::Content;
+
+AssetData::AssetData() :
+	data( nullptr ),
+	size( 0 ) {
+}//Ctor()
+
+const byte* AssetData::GetData() const {
+	return data;
+}//GetData()
+
+std::uint32_t AssetData::GetSize() const {
+	return size;
+}//GetSize()
+
+bool AssetData::IsMapped() const {
+	return decompressed.empty() && size > 0;
+}//IsMapped()
+
+AssetPack::AssetPack() :
+	header( nullptr ),
+	entries( nullptr ) {
+}//Ctor()
+
+AssetPack::~AssetPack() {
+	Close();
+}//Dtor()
+
+bool AssetPack::Open( const wchar_t *filename ) {
+	Close();
+
+	file = std::make_shared<MappedFile>();
+
+	if ( !file->Open( filename ) || file->GetSize() < sizeof( AssetPackHeader ) ) {
+		Close();
+		return false;
+	}
+
+	header	= reinterpret_cast<const AssetPackHeader*>( file->GetData() );
+	entries	= reinterpret_cast<const AssetPackEntry*>( file->GetData() + sizeof( AssetPackHeader ) );
+
+	if ( !Validate() ) {
+		Close();
+		return false;
+	}
+
+	decompressedAssets.resize( header->EntryCount );
+
+#if _DEBUG
+	std::wstringstream ss;
+	ss << L"Asset pack: " << header->EntryCount << L" entries, " << file->GetSize() << L" bytes mapped\n";
+	Utility::WriteDebugMessage( L"%s", ss.str().c_str() );
+#endif
+
+	return true;
+}//Open()
+
+//Every payload has to be inside the file
+bool AssetPack::Validate() const {
+	if ( header->Magic != AssetPackMagic || header->Version != AssetPackVersion || header->Alignment != AssetPackAlignment ) {
+		return false;
+	}
+
+	const std::uint64_t size = file->GetSize();
+
+	if ( sizeof( AssetPackHeader ) + static_cast<std::uint64_t>( header->EntryCount ) * sizeof( AssetPackEntry ) > size ) {
+		return false;
+	}
+
+	for ( std::uint32_t i = 0; i < header->EntryCount; ++i ) {
+		const auto &entry = entries[i];
+
+		if ( entry.Offset % AssetPackAlignment != 0 || entry.Offset > size || entry.StoredSize > size - entry.Offset ) {
+			return false;
+		}
+
+		if ( !( entry.Flags & AssetPackCompressed ) && entry.StoredSize != entry.Size ) {
+			return false;
+		}
+
+		//Find() relies on the order
+		if ( i > 0 && entries[i - 1].NameHash >= entry.NameHash ) {
+			return false;
+		}
+	}
+
+	return true;
+}//Validate()
+
+void AssetPack::Close() {
+	file	= nullptr;
+	header	= nullptr;
+	entries	= nullptr;
+
+	std::lock_guard<std::mutex> guard( decompressedLock );
+	decompressedAssets.clear();
+}//Close()
+
+bool AssetPack::IsOpen() const {
+	return header != nullptr;
+}//IsOpen()
+
+const AssetPackEntry* AssetPack::Find( const wchar_t *name ) const {
+	if ( !header ) {
+		return nullptr;
+	}
+
+	auto hash	= HashAssetName( name );
+	auto last	= entries + header->EntryCount;
+	auto entry	= std::lower_bound( entries, last, hash, []( const AssetPackEntry &left, std::uint64_t right ) {
+		return left.NameHash < right;
+	} );
+
+	return ( entry != last && entry->NameHash == hash ) ? entry : nullptr;
+}//Find()
+
+bool AssetPack::Contains( const wchar_t *name ) const {
+	return Find( name ) != nullptr;
+}//Contains()
+
+std::shared_ptr<const AssetData> AssetPack::Load( const wchar_t *name ) const {
+	auto entry = Find( name );
+
+	if ( !entry ) {
+		return nullptr;
+	}
+
+	auto payload = file->GetData() + entry->Offset;
+
+	if ( entry->Flags & AssetPackCompressed ) {
+		std::lock_guard<std::mutex> guard( decompressedLock );
+		auto &cached = decompressedAssets[entry - entries];
+
+		if ( auto shared = cached.lock() ) {
+			return shared;
+		}
+
+		auto asset = std::make_shared<AssetData>();
+		asset->decompressed.resize( entry->Size );
+
+		if ( !DecompressAsset( payload, entry->StoredSize, asset->decompressed.data(), entry->Size ) ) {
+#if _DEBUG
+			Utility::WriteDebugMessage( L"Asset pack: corrupt entry\n" );
+#endif
+			return nullptr;
+		}
+
+		asset->data = asset->decompressed.data();
+		asset->size = entry->Size;
+		cached		= asset;
+
+		return asset;
+	}
+
+	//The mapping outlives the pack as long as the asset is used
+	auto asset = std::make_shared<AssetData>();
+
+	asset->data = payload;
+	asset->size = entry->Size;
+	asset->file = file;
+
+	return asset;
+}//Load()
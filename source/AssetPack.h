@@ -0,0 +1,93 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+#pragma once
+
+#include "AssetPackFormat.h"
+#include <mutex>
+
+namespace WinGame {
+	namespace Content {
+		class MappedFile;
+
+		//NOTE: The bytes of one asset. Stored entries point straight into the mapping of the
+		//		pack, compressed ones own the decompressed copy. Either way the data stays valid
+		//		as long as the AssetData lives, even when the pack is closed in the meantime.
+		class AssetData {
+		public:
+			explicit AssetData();
+
+			const byte*		GetData() const;
+			std::uint32_t	GetSize() const;
+			bool			IsMapped() const;
+
+		private:
+			friend class AssetPack;
+
+			AssetData( const AssetData& );
+			AssetData& operator=( const AssetData& );
+
+			const byte							*data;
+			std::uint32_t						size;
+			std::vector<byte>					decompressed;
+			std::shared_ptr<const MappedFile>	file;
+
+		};//AssetData class
+
+		//NOTE: One file built by the AssetPackBuilder tool holding every texture, font, map and
+		//		sound bank of the game. It is mapped once at startup, so loading an asset is a
+		//		binary search over the table of contents instead of opening a file. A compressed
+		//		asset is decompressed once and shared by every Load() while any of them is kept.
+		class AssetPack {
+		public:
+			explicit AssetPack();
+			~AssetPack();
+
+			//Returns false if the file is missing or not a valid pack
+			bool Open( const wchar_t *filename );
+			void Close();
+			bool IsOpen() const;
+
+			bool Contains( const wchar_t *name ) const;
+
+			//Returns nullptr if the pack does not contain the asset or it does not decompress
+			std::shared_ptr<const AssetData> Load( const wchar_t *name ) const;
+
+		private:
+			AssetPack( const AssetPack& );
+			AssetPack& operator=( const AssetPack& );
+
+			bool					Validate() const;
+			const AssetPackEntry*	Find( const wchar_t *name ) const;
+
+			std::shared_ptr<MappedFile>	file;
+			const AssetPackHeader		*header;
+			const AssetPackEntry		*entries;
+
+			//Decompressed assets by entry, Load() may be called from loading tasks
+			mutable std::vector<std::weak_ptr<const AssetData>>	decompressedAssets;
+			mutable std::mutex									decompressedLock;
+
+		};//AssetPack class
+
+	}//Content namespace
+}//WinGame namespace
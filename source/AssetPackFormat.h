@@ -0,0 +1,76 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+#pragma once
+
+//NOTE: Only fixed size types and no includes of the game, the offline AssetPackBuilder tool
+//		writes packs with this header as well.
+namespace WinGame {
+	namespace Content {
+		const std::uint32_t AssetPackMagic		= 0x4B415042;	//"BPAK"
+		const std::uint32_t AssetPackVersion	= 1U;
+		const std::uint32_t AssetPackAlignment	= 64U;
+
+		//Entry flags
+		const std::uint32_t AssetPackCompressed	= 0x1U;		//Stored with CompressAsset()
+
+		//NOTE: A pack is this header, EntryCount entries sorted by NameHash and then the payloads.
+		//		Every payload starts at a multiple of AssetPackAlignment, so textures, fonts and
+		//		sound banks stored as they are can be used straight from the mapping.
+		struct AssetPackHeader {
+			std::uint32_t	Magic;
+			std::uint32_t	Version;
+			std::uint32_t	EntryCount;
+			std::uint32_t	Alignment;
+		};//AssetPackHeader struct
+
+		struct AssetPackEntry {
+			std::uint64_t	NameHash;
+			std::uint64_t	Offset;			//From the start of the file
+			std::uint32_t	StoredSize;		//Bytes in the pack
+			std::uint32_t	Size;			//Bytes after decompression
+			std::uint32_t	Flags;
+			std::uint32_t	Reserved;
+		};//AssetPackEntry struct
+
+		//FNV-1a over the filename as the game asks for it, case and slash direction ignored
+		inline std::uint64_t HashAssetName( const wchar_t *name ) {
+			std::uint64_t hash = 14695981039346656037ULL;
+
+			for ( auto c = name; *c; ++c ) {
+				std::uint32_t unit = static_cast<std::uint32_t>( *c ) & 0xFFFF;
+
+				if ( unit == L'/' ) {
+					unit = L'\\';
+				} else if ( unit >= L'A' && unit <= L'Z' ) {
+					unit += L'a' - L'A';
+				}
+
+				hash = ( hash ^ ( unit & 0xFF ) ) * 1099511628211ULL;
+				hash = ( hash ^ ( unit >> 8 ) ) * 1099511628211ULL;
+			}
+
+			return hash;
+		}//HashAssetName()
+
+	}//Content namespace
+}//WinGame namespace
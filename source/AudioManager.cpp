@@ -23,12 +23,27 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "pch.h"
 #include "AudioManager.h"
+#include "XAudio2Output.h"
 
 using namespace WinGame;
 using namespace WinGame::Audio;
 using namespace Microsoft::WRL;
 using namespace Windows::ApplicationModel;
 
+static std::uint64_t GetSourceSize( const wchar_t *filename ) {
+	std::ifstream file( filename, std::ios::binary | std::ios::ate );
+	return file.is_open() ? static_cast<std::uint64_t>( file.tellg() ) : 0;
+}//GetSourceSize()
+
+//Assets\Music\Song.wma becomes Assets_Music_Song_wma.pcm
+static std::wstring GetMusicCacheName( const wchar_t *filename ) {
+	std::wstring name( filename );
+	std::replace( std::begin( name ), std::end( name ), L'\\', L'_' );
+	std::replace( std::begin( name ), std::end( name ), L'/', L'_' );
+	std::replace( std::begin( name ), std::end( name ), L'.', L'_' );
+	return name + L".pcm";
+}//GetMusicCacheName()
+
 class AudioManager::Impl {
 public:
 	Impl();
@@ -40,7 +55,13 @@ public:
 	IXAudio2MasteringVoice	*soundMasteringVoice; //NOTE: We only get softpointers since soundEngine->Release() will destroy all used Voices.
 	IXAudio2MasteringVoice	*musicMasteringVoice;
 
+	std::shared_ptr<AudioThread> thread;
+	std::wstring musicCacheFolder;
+
+	std::shared_ptr<SoundBank> soundBank;
+
 	void CreateDeviceIndependentResources();
+	WAVEFORMATEX* DecodeSound( const wchar_t *filename, std::vector<byte> &data );
 };//AudioManager::Impl class
 
 AudioManager::Impl::Impl() :
@@ -86,130 +107,15 @@ void AudioManager::Impl::CreateDeviceIndependentResources() {
 		musicEngine->CreateMasteringVoice( &musicMasteringVoice )
 		);
 
+	thread = std::make_shared<AudioThread>();
+	thread->Start();
+
 	this->isInitialized = true;
 }//CreateDeviceIndependentResources()
 
-AudioManager::AudioManager() :
-	pImpl( new Impl() ) {
-}//Ctor()
-
-AudioManager::~AudioManager() {
-	pImpl = nullptr;
-}//Dtor()
-
-UTILITY_CLASS_PIMPL_IMPL( AudioManager );
-
-void AudioManager::Initialize() {
-	pImpl->CreateDeviceIndependentResources();
-}//Initialize()
-
-void AudioManager::Suspend() {
-	if ( pImpl->isInitialized ) {
-		pImpl->soundEngine->StopEngine();
-		pImpl->musicEngine->StopEngine();
-	}
-}//Suspend()
-
-void AudioManager::Resume() {
-	if ( pImpl->isInitialized ) {
-		Utility::ThrowIfFailed( pImpl->soundEngine->StartEngine() );
-		Utility::ThrowIfFailed( pImpl->musicEngine->StartEngine() );
-	}
-}//Resume()
-
-std::shared_ptr<Music> AudioManager::CreateMusic( const wchar_t *filename ) const {
-	if ( !pImpl->isInitialized ) {
-		return nullptr;
-	}
-
-	Utility::ThrowIfFailed( MFStartup( MF_VERSION ) );
-
-	auto path	= Platform::String::Concat( Package::Current->InstalledLocation->Path, "\\" );
-	auto music	= std::make_shared<Music>();
-
-	Utility::ThrowIfFailed(
-		MFCreateSourceReaderFromURL(
-			Platform::String::Concat( path, ref new Platform::String( filename ) )->Data(),
-			nullptr,
-			&music->reader
-			)
-		);
-
-	//Set the decoded output format as PCM
-	//Note: XAudio2 on Windows can process PCM and ADPCM-encoded buffers.
-	ComPtr<IMFMediaType> mediaType;
-
-	Utility::ThrowIfFailed(
-		MFCreateMediaType( &mediaType )
-		);
-
-	Utility::ThrowIfFailed(
-		mediaType->SetGUID( MF_MT_MAJOR_TYPE, MFMediaType_Audio )
-		);
-
-	Utility::ThrowIfFailed(
-		mediaType->SetGUID( MF_MT_SUBTYPE, MFAudioFormat_PCM )
-		);
-
-	Utility::ThrowIfFailed(
-		music->reader->SetCurrentMediaType(
-			static_cast<std::uint32_t>( MF_SOURCE_READER_FIRST_AUDIO_STREAM ), 
-			0, 
-			mediaType.Get()
-			)
-		);
-
-	//Get the Complete WAVEFORMAT from the Media Type
-	ComPtr<IMFMediaType> outputMediaType;
-
-	Utility::ThrowIfFailed(
-		music->reader->GetCurrentMediaType(
-			static_cast<std::uint32_t>( MF_SOURCE_READER_FIRST_AUDIO_STREAM ),
-			&outputMediaType
-			)
-		);
-
-	UINT32			size = 0;
-	WAVEFORMATEX	*waveFormat;
-
-	Utility::ThrowIfFailed(
-		MFCreateWaveFormatExFromMFMediaType( outputMediaType.Get(), &waveFormat, &size )
-		);
-
-	//TODO: Maybe we don't need that part! v
-
-	//Get the total length of th Stream in bytes
-	//PROPVARIANT propVariant;
-
-	//Utility::ThrowIfFailed(
-	//	music->reader->GetPresentationAttribute(
-	//		static_cast<std::uint32_t>(MF_SOURCE_READER_MEDIASOURCE),
-	//		MF_PD_DURATION,
-	//		&propVariant
-	//		)
-	//	);
-
-	//LONGLONG duration = propVariant.uhVal.QuadPart;
-	//std::uint32_t maxStreamLengthInBytes;
-
-	//double durationInSeconds = (duration / static_cast<double>(10000 * 1000));
-	//maxStreamLengthInBytes = static_cast<std::uint32_t>(durationInSeconds * waveFormat->nAvgBytesPerSec);
-	
-	//Create Music
-	Utility::ThrowIfFailed(
-		pImpl->musicEngine->CreateSourceVoice( &music->sourceVoice, waveFormat )
-		);
-
-	CoTaskMemFree( waveFormat );
-	music->isInitialized = true;
-	return music;
-}//CreateMusic()
-
-std::shared_ptr<Sound> AudioManager::CreateSound( const wchar_t *filename ) const {
-	if ( !pImpl->isInitialized ) {
-		return nullptr;
-	}
-
+//Decodes a whole sound with Media Foundation into data, the returned format has to be
+//released with CoTaskMemFree()
+WAVEFORMATEX* AudioManager::Impl::DecodeSound( const wchar_t *filename, std::vector<byte> &data ) {
 	Utility::ThrowIfFailed( MFStartup( MF_VERSION ) );
 
 	auto path = Platform::String::Concat( Package::Current->InstalledLocation->Path, "\\" );
@@ -273,22 +179,17 @@ std::shared_ptr<Sound> AudioManager::CreateSound( const wchar_t *filename ) cons
 			)
 		);
 
-	LONGLONG		duration = propVariant.uhVal.QuadPart;
-	std::uint32_t	maxStreamLengthInBytes;
+	LONGLONG	duration			= propVariant.uhVal.QuadPart;
+	double		durationInSeconds	= ( duration / static_cast<double>( 10000 * 1000 ) );
 
-	double durationInSeconds	= ( duration / static_cast<double>( 10000 * 1000 ) );
-	maxStreamLengthInBytes		= static_cast<std::uint32_t>( durationInSeconds * waveFormat->nAvgBytesPerSec );
-
-	//make length a multilple of 4 bytes
-	maxStreamLengthInBytes = ( maxStreamLengthInBytes + 3 ) / 4 * 4;
-	Platform::Array<byte> ^fileData = ref new Platform::Array<byte>( maxStreamLengthInBytes );
+	//The duration is only an estimate, reserving it saves reallocating on the way
+	data.clear();
+	data.reserve( static_cast<std::size_t>( durationInSeconds * waveFormat->nAvgBytesPerSec ) + 4 );
 
 	ComPtr<IMFSample>		sample;
 	ComPtr<IMFMediaBuffer>	mediaBuffer;
-	DWORD					flags = 0;
-
-	int		positionInData	= 0;
-	bool	done			= false;
+	DWORD					flags	= 0;
+	bool					done	= false;
 
 	while ( !done ) {
 		Utility::ThrowIfFailed(
@@ -307,9 +208,11 @@ std::shared_ptr<Sound> AudioManager::CreateSound( const wchar_t *filename ) cons
 				mediaBuffer->Lock( &audioData, nullptr, &sampleBufferLength )
 				);
 
-			for ( DWORD i = 0; i < sampleBufferLength; ++i ) {
-				fileData[positionInData++] = audioData[i];
-			}
+			data.insert( std::end( data ), audioData, audioData + sampleBufferLength );
+
+			Utility::ThrowIfFailed(
+				mediaBuffer->Unlock()
+				);
 		}
 
 		if ( flags & MF_SOURCE_READERF_ENDOFSTREAM ) {
@@ -317,20 +220,241 @@ std::shared_ptr<Sound> AudioManager::CreateSound( const wchar_t *filename ) cons
 		}
 	}
 
-	auto sound = std::make_shared<Sound>();
+	//make length a multilple of 4 bytes
+	data.resize( ( data.size() + 3 ) / 4 * 4 );
+	return waveFormat;
+}//DecodeSound()
+
+AudioManager::AudioManager() :
+	pImpl( new Impl() ) {
+}//Ctor()
+
+AudioManager::~AudioManager() {
+	//Sounds and music outliving the manager keep the thread, stop it before the engines go away
+	if ( pImpl && pImpl->thread ) {
+		pImpl->thread->Stop();
+	}
+
+	pImpl = nullptr;
+}//Dtor()
+
+UTILITY_CLASS_PIMPL_IMPL( AudioManager );
+
+void AudioManager::Initialize() {
+	pImpl->CreateDeviceIndependentResources();
+}//Initialize()
+
+void AudioManager::Suspend() {
+	if ( pImpl->isInitialized ) {
+		pImpl->soundEngine->StopEngine();
+		pImpl->musicEngine->StopEngine();
+	}
+}//Suspend()
+
+void AudioManager::Resume() {
+	if ( pImpl->isInitialized ) {
+		Utility::ThrowIfFailed( pImpl->soundEngine->StartEngine() );
+		Utility::ThrowIfFailed( pImpl->musicEngine->StartEngine() );
+	}
+}//Resume()
 
-	//Fix up the array size on match the actual length.
-	Platform::Array<byte> ^realFileData = ref new Platform::Array<byte>( ( positionInData + 3 ) / 4 * 4 );
+std::shared_ptr<Music> AudioManager::CreateMusic( const wchar_t *filename ) const {
+	if ( !pImpl->isInitialized ) {
+		return nullptr;
+	}
 
-	memcpy( realFileData->Data, fileData->Data, positionInData );
-	sound->data = realFileData;
+	Utility::ThrowIfFailed( MFStartup( MF_VERSION ) );
 
-	//Create Sound
+	auto path	= Platform::String::Concat( Package::Current->InstalledLocation->Path, "\\" );
+	auto source	= Platform::String::Concat( path, ref new Platform::String( filename ) );
+	auto music	= std::make_shared<Music>();
+	music->thread = pImpl->thread;
+
+	//Decoded PCM from an earlier run skips Media Foundation entirely
+	std::vector<byte>	format;
+	std::uint64_t		sourceSize = 0;
+
+	if ( !pImpl->musicCacheFolder.empty() ) {
+		sourceSize				= GetSourceSize( source->Data() );
+		music->cacheFilename	= pImpl->musicCacheFolder + L"\\" + GetMusicCacheName( filename );
+		music->OpenCache( sourceSize, format );
+	}
+
+	if ( format.empty() ) {
+		Utility::ThrowIfFailed(
+			MFCreateSourceReaderFromURL(
+				source->Data(),
+				nullptr,
+				&music->reader
+				)
+			);
+
+		//Set the decoded output format as PCM
+		//Note: XAudio2 on Windows can process PCM and ADPCM-encoded buffers.
+		ComPtr<IMFMediaType> mediaType;
+
+		Utility::ThrowIfFailed(
+			MFCreateMediaType( &mediaType )
+			);
+
+		Utility::ThrowIfFailed(
+			mediaType->SetGUID( MF_MT_MAJOR_TYPE, MFMediaType_Audio )
+			);
+
+		Utility::ThrowIfFailed(
+			mediaType->SetGUID( MF_MT_SUBTYPE, MFAudioFormat_PCM )
+			);
+
+		Utility::ThrowIfFailed(
+			music->reader->SetCurrentMediaType(
+				static_cast<std::uint32_t>( MF_SOURCE_READER_FIRST_AUDIO_STREAM ), 
+				0, 
+				mediaType.Get()
+				)
+			);
+
+		//Get the Complete WAVEFORMAT from the Media Type
+		ComPtr<IMFMediaType> outputMediaType;
+
+		Utility::ThrowIfFailed(
+			music->reader->GetCurrentMediaType(
+				static_cast<std::uint32_t>( MF_SOURCE_READER_FIRST_AUDIO_STREAM ),
+				&outputMediaType
+				)
+			);
+
+		UINT32			size = 0;
+		WAVEFORMATEX	*waveFormat;
+
+		Utility::ThrowIfFailed(
+			MFCreateWaveFormatExFromMFMediaType( outputMediaType.Get(), &waveFormat, &size )
+			);
+
+		format.assign( reinterpret_cast<byte*>( waveFormat ), reinterpret_cast<byte*>( waveFormat ) + size );
+		CoTaskMemFree( waveFormat );
+
+		if ( !music->cacheFilename.empty() ) {
+			music->CreateCache( sourceSize, format );
+		}
+	}
+
+	auto waveFormat = reinterpret_cast<const WAVEFORMATEX*>( &format[0] );
+
+	//Create Music
 	Utility::ThrowIfFailed(
-		pImpl->soundEngine->CreateSourceVoice( &sound->sourceVoice, waveFormat )
+		pImpl->musicEngine->CreateSourceVoice( &music->sourceVoice, waveFormat )
 		);
 
-	CoTaskMemFree( waveFormat );
+	music->isInitialized = true;
+	music->StartDecoder( waveFormat->nBlockAlign );
+	return music;
+}//CreateMusic()
+
+std::shared_ptr<Sound> AudioManager::CreateSound( const wchar_t *filename ) const {
+	if ( !pImpl->isInitialized ) {
+		return nullptr;
+	}
+
+	auto sound		= std::make_shared<Sound>();
+	sound->thread	= pImpl->thread;
+
+	WAVEFORMATEX	bankFormat;
+	WAVEFORMATEX	*decodedFormat	= nullptr;
+	const auto		*entry			= pImpl->soundBank ? pImpl->soundBank->Find( filename ) : nullptr;
+
+	if ( entry ) {
+		//Voices read straight from the mapped bank
+		pImpl->soundBank->GetFormat( bankFormat );
+
+		sound->bank			= pImpl->soundBank;
+		sound->audioData	= pImpl->soundBank->GetData( entry );
+		sound->audioBytes	= pImpl->soundBank->GetDataSize( entry );
+	} else {
+#if _DEBUG
+		Utility::WriteDebugMessage( L"%s is not in the sound bank, decoding it\n", filename );
+#endif
+
+		decodedFormat		= pImpl->DecodeSound( filename, sound->decodedData );
+		sound->audioData	= sound->decodedData.data();
+		sound->audioBytes	= static_cast<std::uint32_t>( sound->decodedData.size() );
+	}
+
+	//Create Sound Voices, started right away so playing only needs a buffer submitted
+	for ( std::size_t i = 0; i < MaximumSoundVoices; ++i ) {
+		Sound::Voice voice = { nullptr, 0 };
+
+		Utility::ThrowIfFailed(
+			pImpl->soundEngine->CreateSourceVoice( &voice.SourceVoice, entry ? &bankFormat : decodedFormat )
+			);
+
+		sound->voices.push_back( voice );
+
+		Utility::ThrowIfFailed(
+			voice.SourceVoice->Start()
+			);
+	}
+
+	if ( decodedFormat ) {
+		CoTaskMemFree( decodedFormat );
+	}
+
 	sound->isInitialized = true;
 	return sound;
 }//CreateSound()
+
+bool AudioManager::LoadSoundBank( const wchar_t *filename ) {
+	auto path = Platform::String::Concat( Package::Current->InstalledLocation->Path, "\\" );
+	auto bank = std::make_shared<SoundBank>();
+
+	//Sounds created before keep the bank they were made from
+	if ( !bank->Open( Platform::String::Concat( path, ref new Platform::String( filename ) )->Data() ) ) {
+		pImpl->soundBank = nullptr;
+		return false;
+	}
+
+	pImpl->soundBank = bank;
+	return true;
+}//LoadSoundBank()
+
+bool AudioManager::LoadSoundBank( const byte *data, std::uint64_t size, std::shared_ptr<const void> owner ) {
+	auto bank = std::make_shared<SoundBank>();
+
+	if ( !bank->Open( data, size, owner ) ) {
+		pImpl->soundBank = nullptr;
+		return false;
+	}
+
+	pImpl->soundBank = bank;
+	return true;
+}//LoadSoundBank()
+
+void AudioManager::SetMusicCacheFolder( const wchar_t *folder ) {
+	pImpl->musicCacheFolder = folder ? folder : L"";
+}//SetMusicCacheFolder()
+
+std::unique_ptr<IAudioOutput> AudioManager::CreateMixerOutput() const {
+	if ( !pImpl->isInitialized ) {
+		return nullptr;
+	}
+
+	return std::make_unique<XAudio2Output>( pImpl->soundEngine.Get() );
+}//CreateMixerOutput()
+
+void AudioManager::Commit() {
+	if ( pImpl->isInitialized ) {
+		pImpl->thread->Commit();
+	}
+}//Commit()
+
+void AudioManager::GetLatencyHistogram( std::uint64_t (&histogram)[AudioLatencyBucketCount] ) const {
+	if ( !pImpl->isInitialized ) {
+		std::fill( std::begin( histogram ), std::end( histogram ), 0 );
+		return;
+	}
+
+	pImpl->thread->GetLatencyHistogram( histogram );
+}//GetLatencyHistogram()
+
+std::uint64_t AudioManager::GetOverflowCount() const {
+	return pImpl->isInitialized ? pImpl->thread->GetOverflowCount() : 0;
+}//GetOverflowCount()
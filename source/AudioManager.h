@@ -25,6 +25,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Sound.h"
 #include "Music.h"
+#include "IAudioOutput.h"
 
 namespace WinGame {
 	namespace Audio {
@@ -39,9 +40,27 @@ namespace WinGame {
 			void Suspend();
 			void Resume();
 
+			//Sounds found in the bank are created without decoding, others fall back to
+			//Media Foundation. Returns false if the bank could not be opened.
+			bool LoadSoundBank( const wchar_t *filename );
+			//A bank already in memory, e.g. inside an asset pack, owner keeps it alive
+			bool LoadSoundBank( const byte *data, std::uint64_t size, std::shared_ptr<const void> owner );
+
 			std::shared_ptr<Sound> CreateSound( const wchar_t *filename ) const;
 			std::shared_ptr<Music> CreateMusic( const wchar_t *filename ) const;
 
+			//Music decoded once is kept as PCM in this folder, nullptr turns the cache off
+			void SetMusicCacheFolder( const wchar_t *folder );
+
+			//Output for a software Mixer that plays through the sound engine
+			std::unique_ptr<IAudioOutput> CreateMixerOutput() const;
+
+			//Wakes the audio thread up for everything queued this frame
+			void Commit();
+
+			void GetLatencyHistogram( std::uint64_t (&histogram)[AudioLatencyBucketCount] ) const;
+			std::uint64_t GetOverflowCount() const;
+
 		private:
 			UTILITY_CLASS_COPY( AudioManager );
 			UTILITY_CLASS_PIMPL();
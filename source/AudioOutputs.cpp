@@ -0,0 +1,155 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "AudioOutputs.h"
+
+using namespace WinGame;
+using namespace WinGame::Audio;
+
+const std::uint32_t WaveHeaderSize = 44U;
+
+//.wav files are little endian no matter what the host is
+static void WriteUInt16( std::ofstream &file, std::uint16_t value ) {
+	char bytes[2] = {
+		static_cast<char>( value & 0xFF ),
+		static_cast<char>( ( value >> 8 ) & 0xFF )
+	};
+
+	file.write( bytes, sizeof( bytes ) );
+}//WriteUInt16()
+
+static void WriteUInt32( std::ofstream &file, std::uint32_t value ) {
+	WriteUInt16( file, static_cast<std::uint16_t>( value & 0xFFFF ) );
+	WriteUInt16( file, static_cast<std::uint16_t>( value >> 16 ) );
+}//WriteUInt32()
+
+NullAudioOutput::NullAudioOutput() :
+	writtenFrames( 0 ) {
+}//Ctor()
+
+NullAudioOutput::~NullAudioOutput() {
+}//Dtor()
+
+bool NullAudioOutput::Open( std::uint32_t /*sampleRate*/, std::uint32_t /*channelCount*/ ) {
+	writtenFrames = 0;
+	return true;
+}//Open()
+
+void NullAudioOutput::Close() {
+}//Close()
+
+std::uint32_t NullAudioOutput::GetWritableFrames() const {
+	return UINT32_MAX;
+}//GetWritableFrames()
+
+void NullAudioOutput::Write( const std::int16_t * /*frames*/, std::uint32_t frameCount ) {
+	writtenFrames += frameCount;
+}//Write()
+
+std::uint64_t NullAudioOutput::GetWrittenFrames() const {
+	return writtenFrames;
+}//GetWrittenFrames()
+
+WaveFileOutput::WaveFileOutput( const std::string &filename ) :
+	filename( filename ),
+	buffer( 0 ),
+	sampleRate( 0 ),
+	channelCount( 0 ),
+	dataSize( 0 ) {
+}//Ctor()
+
+WaveFileOutput::~WaveFileOutput() {
+	Close();
+}//Dtor()
+
+bool WaveFileOutput::Open( std::uint32_t sampleRate, std::uint32_t channelCount ) {
+	Close();
+
+	file.open( filename.c_str(), std::ios::binary | std::ios::trunc );
+
+	if ( !file.is_open() ) {
+		return false;
+	}
+
+	this->sampleRate	= sampleRate;
+	this->channelCount	= channelCount;
+	this->dataSize		= 0;
+
+	WriteHeader();
+	return file.good();
+}//Open()
+
+void WaveFileOutput::Close() {
+	if ( !file.is_open() ) {
+		return;
+	}
+
+	//Rewrite the header now that the size of the data is known
+	file.seekp( 0 );
+	WriteHeader();
+	file.close();
+}//Close()
+
+void WaveFileOutput::WriteHeader() {
+	std::uint16_t blockAlign = static_cast<std::uint16_t>( channelCount * sizeof( std::int16_t ) );
+
+	file.write( "RIFF", 4 );
+	WriteUInt32( file, WaveHeaderSize - 8 + dataSize );
+	file.write( "WAVE", 4 );
+
+	file.write( "fmt ", 4 );
+	WriteUInt32( file, 16 );
+	WriteUInt16( file, 1 );		//PCM
+	WriteUInt16( file, static_cast<std::uint16_t>( channelCount ) );
+	WriteUInt32( file, sampleRate );
+	WriteUInt32( file, sampleRate * blockAlign );
+	WriteUInt16( file, blockAlign );
+	WriteUInt16( file, 16 );	//Bits per sample
+
+	file.write( "data", 4 );
+	WriteUInt32( file, dataSize );
+}//WriteHeader()
+
+std::uint32_t WaveFileOutput::GetWritableFrames() const {
+	return file.is_open() ? UINT32_MAX : 0;
+}//GetWritableFrames()
+
+void WaveFileOutput::Write( const std::int16_t *frames, std::uint32_t frameCount ) {
+	if ( !file.is_open() ) {
+		return;
+	}
+
+	std::uint32_t sampleCount = frameCount * channelCount;
+	buffer.resize( sampleCount * sizeof( std::int16_t ) );
+
+	for ( std::uint32_t i = 0; i < sampleCount; ++i ) {
+		auto value = static_cast<std::uint16_t>( frames[i] );
+
+		buffer[i * 2]		= static_cast<char>( value & 0xFF );
+		buffer[i * 2 + 1]	= static_cast<char>( value >> 8 );
+	}
+
+	file.write( buffer.data(), buffer.size() );
+	dataSize += static_cast<std::uint32_t>( buffer.size() );
+}//Write()
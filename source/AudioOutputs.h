@@ -0,0 +1,80 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "IAudioOutput.h"
+#include <fstream>
+
+namespace WinGame {
+	namespace Audio {
+		//Throws every frame away, for benchmarking the mixer on its own
+		class NullAudioOutput : public IAudioOutput {
+		public:
+			explicit NullAudioOutput();
+			virtual ~NullAudioOutput();
+
+			virtual bool Open( std::uint32_t sampleRate, std::uint32_t channelCount );
+			virtual void Close();
+
+			virtual std::uint32_t	GetWritableFrames() const;
+			virtual void			Write( const std::int16_t *frames, std::uint32_t frameCount );
+
+			std::uint64_t GetWrittenFrames() const;
+
+		private:
+			std::uint64_t writtenFrames;
+
+		};//NullAudioOutput class
+
+		//NOTE: Writes a 16 bit PCM .wav file, the sizes in the header are filled in by Close().
+		//		Mixing the same commands always writes the same file, so it can be compared
+		//		against a known good recording.
+		class WaveFileOutput : public IAudioOutput {
+		public:
+			explicit WaveFileOutput( const std::string &filename );
+			virtual ~WaveFileOutput();
+
+			virtual bool Open( std::uint32_t sampleRate, std::uint32_t channelCount );
+			virtual void Close();
+
+			virtual std::uint32_t	GetWritableFrames() const;
+			virtual void			Write( const std::int16_t *frames, std::uint32_t frameCount );
+
+		private:
+			WaveFileOutput( const WaveFileOutput& );
+			WaveFileOutput& operator=( const WaveFileOutput& );
+
+			void WriteHeader();
+
+			std::string			filename;
+			std::ofstream		file;
+			std::vector<char>	buffer;
+			std::uint32_t		sampleRate;
+			std::uint32_t		channelCount;
+			std::uint32_t		dataSize;
+
+		};//WaveFileOutput class
+
+	}//Audio namespace
+}//WinGame namespace
@@ -0,0 +1,246 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "AudioThread.h"
+#include "Sound.h"
+#include "Music.h"
+
+using namespace WinGame;
+using namespace WinGame::Audio;
+
+static std::int64_t GetTimestamp() {
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter( &counter );
+	return counter.QuadPart;
+}//GetTimestamp()
+
+AudioThread::AudioThread() :
+	playingMusic( 0 ),
+	wakeEvent( nullptr ),
+	isRunning( false ),
+	frequency( 1 ),
+	fenceCount( 0 ),
+	startCount( 0 ) {
+
+	LARGE_INTEGER counterFrequency;
+
+	if ( !QueryPerformanceFrequency( &counterFrequency ) ) {
+		UTILITY_THROW_EX( E_FAIL );
+	}
+
+	frequency = counterFrequency.QuadPart;
+	wakeEvent = CreateEventEx( nullptr, nullptr, 0, EVENT_ALL_ACCESS );
+
+	if ( !wakeEvent ) {
+		Utility::ThrowIfFailed( HRESULT_FROM_WIN32( GetLastError() ) );
+	}
+
+	completedFence.store( 0 );
+	overflowCount.store( 0 );
+
+	for ( auto &bucket : latency ) {
+		bucket.store( 0 );
+	}
+}//Ctor()
+
+AudioThread::~AudioThread() {
+	Stop();
+	CloseHandle( wakeEvent );
+}//Dtor()
+
+void AudioThread::Start() {
+	if ( isRunning ) {
+		return;
+	}
+
+	thread		= std::thread( [this]() {
+		Run();
+	} );
+
+	isRunning	= true;
+}//Start()
+
+void AudioThread::Stop() {
+	if ( !isRunning ) {
+		return;
+	}
+
+	AudioCommand command = { AUDIO_COMMAND::EXIT, false, 0.0f, nullptr, nullptr, 0 };
+	EnqueueWait( command );
+
+	thread.join();
+	isRunning = false;
+}//Stop()
+
+bool AudioThread::Enqueue( const AudioCommand &command ) {
+	if ( !isRunning ) {
+		return false;
+	}
+
+	if ( !commands.Push( command ) ) {
+		overflowCount.fetch_add( 1, std::memory_order_relaxed );
+		return false;
+	}
+
+	return true;
+}//Enqueue()
+
+void AudioThread::EnqueueWait( const AudioCommand &command ) {
+	if ( !isRunning ) {
+		return;
+	}
+
+	while ( !commands.Push( command ) ) {
+		SetEvent( wakeEvent );
+		std::this_thread::yield();
+	}
+
+	SetEvent( wakeEvent );
+}//EnqueueWait()
+
+bool AudioThread::PlaySound( Sound *sound, float volume, bool canSteal ) {
+	AudioCommand command = { AUDIO_COMMAND::PLAY_SOUND, canSteal, volume, sound, nullptr, GetTimestamp() };
+	return Enqueue( command );
+}//PlaySound()
+
+bool AudioThread::PlayMusic( Music *music, float volume ) {
+	AudioCommand command = { AUDIO_COMMAND::PLAY_MUSIC, false, volume, nullptr, music, GetTimestamp() };
+	return Enqueue( command );
+}//PlayMusic()
+
+void AudioThread::StopMusic( Music *music ) {
+	AudioCommand command = { AUDIO_COMMAND::STOP_MUSIC, false, 0.0f, nullptr, music, GetTimestamp() };
+	EnqueueWait( command );
+}//StopMusic()
+
+void AudioThread::Commit() {
+	if ( isRunning ) {
+		SetEvent( wakeEvent );
+	}
+}//Commit()
+
+void AudioThread::Synchronize() {
+	if ( !isRunning ) {
+		return;
+	}
+
+	AudioCommand command = { AUDIO_COMMAND::FENCE, false, 0.0f, nullptr, nullptr, ++fenceCount };
+	EnqueueWait( command );
+
+	while ( completedFence.load( std::memory_order_acquire ) < fenceCount ) {
+		std::this_thread::yield();
+	}
+}//Synchronize()
+
+void AudioThread::GetLatencyHistogram( std::uint64_t (&histogram)[AudioLatencyBucketCount] ) const {
+	for ( std::size_t i = 0; i < AudioLatencyBucketCount; ++i ) {
+		histogram[i] = latency[i].load( std::memory_order_relaxed );
+	}
+}//GetLatencyHistogram()
+
+std::uint64_t AudioThread::GetOverflowCount() const {
+	return overflowCount.load( std::memory_order_relaxed );
+}//GetOverflowCount()
+
+void AudioThread::Run() {
+	bool exit = false;
+
+	while ( !exit ) {
+		AudioCommand command;
+
+		while ( commands.Pop( command ) ) {
+			if ( command.Type == AUDIO_COMMAND::EXIT ) {
+				exit = true;
+				break;
+			}
+
+			Execute( command );
+		}
+
+		//Refill whatever the music voices have played since the last wake up
+		for ( auto music : playingMusic ) {
+			music->Stream();
+		}
+
+		if ( !exit ) {
+			WaitForSingleObjectEx( wakeEvent, AudioThreadWaitMilliseconds, FALSE );
+		}
+	}
+}//Run()
+
+void AudioThread::Execute( const AudioCommand &command ) {
+	switch ( command.Type ) {
+	case AUDIO_COMMAND::PLAY_SOUND:
+		if ( command.TargetSound->Start( command.Volume, command.CanSteal ) ) {
+			RecordLatency( command.EnqueueTime );
+		}
+		break;
+
+	case AUDIO_COMMAND::PLAY_MUSIC:
+		command.TargetMusic->Start( command.Volume );
+		playingMusic.push_back( command.TargetMusic );
+		RecordLatency( command.EnqueueTime );
+		break;
+
+	case AUDIO_COMMAND::STOP_MUSIC:
+		command.TargetMusic->Halt();
+		playingMusic.erase( std::remove( std::begin( playingMusic ), std::end( playingMusic ), command.TargetMusic ), std::end( playingMusic ) );
+		break;
+
+	case AUDIO_COMMAND::FENCE:
+		completedFence.store( command.EnqueueTime, std::memory_order_release );
+		break;
+
+	default:
+		break;
+	}
+}//Execute()
+
+void AudioThread::RecordLatency( std::int64_t enqueueTime ) {
+	auto microseconds	= static_cast<std::uint64_t>( ( GetTimestamp() - enqueueTime ) * 1000000 / frequency );
+	std::size_t bucket	= 0;
+
+	while ( microseconds > 1 && bucket < AudioLatencyBucketCount - 1 ) {
+		microseconds >>= 1;
+		++bucket;
+	}
+
+	latency[bucket].fetch_add( 1, std::memory_order_relaxed );
+
+	++startCount;
+
+#if _DEBUG
+	if ( startCount % AudioLatencyReportInterval == 0 ) {
+		std::wstringstream report;
+		report << L"Audio latency after " << startCount << L" starts (us: count):";
+
+		for ( std::size_t i = 0; i < AudioLatencyBucketCount; ++i ) {
+			report << L" <" << ( 2ULL << i ) << L": " << latency[i].load( std::memory_order_relaxed );
+		}
+
+		report << L", " << overflowCount.load( std::memory_order_relaxed ) << L" dropped\n";
+		Utility::WriteDebugMessage( L"%s", report.str().c_str() );
+	}
+#endif
+}//RecordLatency()
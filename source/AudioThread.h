@@ -0,0 +1,111 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "SpscQueue.h"
+
+namespace WinGame {
+	namespace Audio {
+		class Sound;
+		class Music;
+
+		const std::size_t	AudioCommandCapacity		= 256U;
+		const std::uint32_t	AudioThreadWaitMilliseconds	= 5U;
+		const std::size_t	AudioLatencyBucketCount		= 16U;
+		const std::uint64_t	AudioLatencyReportInterval	= 1024U;
+
+		enum class AUDIO_COMMAND : std::uint8_t {
+			PLAY_SOUND,
+			PLAY_MUSIC,
+			STOP_MUSIC,
+			FENCE,
+			EXIT
+		};//AUDIO_COMMAND enum class
+
+		struct AudioCommand {
+			AUDIO_COMMAND	Type;
+			bool			CanSteal;
+			float			Volume;
+			Sound			*TargetSound;
+			Music			*TargetMusic;
+			std::int64_t	EnqueueTime;	//QPC ticks, or the fence number for FENCE
+		};//AudioCommand struct
+
+		//NOTE: Every XAudio2 and Media Foundation call made while playing runs on this thread.
+		//		The game thread only pushes commands into a lock free queue and wakes the thread
+		//		once per frame with Commit(), the thread also wakes up on its own every few
+		//		milliseconds to keep the music buffers filled. All other methods must be called
+		//		from the game thread, it is the only producer of the queue.
+		class AudioThread {
+		public:
+			explicit AudioThread();
+			~AudioThread();
+
+			void Start();
+			void Stop();
+
+			//These return false if the queue was full and the command was dropped
+			bool PlaySound( Sound *sound, float volume, bool canSteal );
+			bool PlayMusic( Music *music, float volume );
+
+			//Never dropped, waits for room in the queue instead
+			void StopMusic( Music *music );
+
+			void Commit();
+
+			//Blocks until every command queued so far has been executed, needed before a
+			//sound or music that may still be referenced by the queue is destroyed
+			void Synchronize();
+
+			//Bucket i counts voice starts that took [2^i, 2^(i+1)) microseconds after being
+			//queued, the first bucket includes everything below 2 and the last everything above
+			void GetLatencyHistogram( std::uint64_t (&histogram)[AudioLatencyBucketCount] ) const;
+			std::uint64_t GetOverflowCount() const;
+
+		private:
+			AudioThread( const AudioThread& );
+			AudioThread& operator=( const AudioThread& );
+
+			bool Enqueue( const AudioCommand &command );
+			void EnqueueWait( const AudioCommand &command );
+			void Run();
+			void Execute( const AudioCommand &command );
+			void RecordLatency( std::int64_t enqueueTime );
+
+			SpscQueue<AudioCommand, AudioCommandCapacity>	commands;
+			std::vector<Music*>								playingMusic;	//Audio thread only
+
+			std::thread					thread;
+			HANDLE						wakeEvent;
+			bool						isRunning;
+			std::int64_t				frequency;
+			std::int64_t				fenceCount;
+			std::uint64_t				startCount;		//Audio thread only
+			std::atomic<std::int64_t>	completedFence;
+			std::atomic<std::uint64_t>	overflowCount;
+			std::atomic<std::uint64_t>	latency[AudioLatencyBucketCount];
+		};//AudioThread class
+
+	}//Audio namespace
+}//WinGame namespace
@@ -0,0 +1,263 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "Autopilot.h"
+#include "Globals.h"
+#include <cfloat>
+#include <cmath>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+using namespace DirectX;
+
+const std::uint32_t	AutopilotMaximumBounces	= 12;
+const float			AutopilotMaximumAim		= 0.8f;
+
+//NOTE: Walks the brick cells along a ray (Amanatides & Woo). The ball is treated as a point at
+//		its hitbox center, axis is 0 if a cell was entered through its left or right side.
+static bool TraceBricks( const BrickManager *bricks, const XMFLOAT2 &position, const XMFLOAT2 &velocity, float maximumTime, float &hitTime, int &axis ) {
+	auto origin = bricks->GetGridOrigin();
+	float localX = ( position.x - origin.x ) / ItemWidth;
+	float localY = ( position.y - origin.y ) / ItemHeight;
+
+	auto column	= static_cast<std::int32_t>( std::floor( localX ) );
+	auto row	= static_cast<std::int32_t>( std::floor( localY ) );
+
+	std::int32_t stepX = velocity.x > 0.0f ? 1 : ( velocity.x < 0.0f ? -1 : 0 );
+	std::int32_t stepY = velocity.y > 0.0f ? 1 : ( velocity.y < 0.0f ? -1 : 0 );
+
+	float deltaX	= stepX != 0 ? ItemWidth / std::fabs( velocity.x ) : FLT_MAX;
+	float deltaY	= stepY != 0 ? ItemHeight / std::fabs( velocity.y ) : FLT_MAX;
+	float nextX		= FLT_MAX;
+	float nextY		= FLT_MAX;
+
+	if ( stepX != 0 ) {
+		nextX = ( stepX > 0 ? static_cast<float>( column + 1 ) - localX : localX - static_cast<float>( column ) ) * deltaX;
+	}
+
+	if ( stepY != 0 ) {
+		nextY = ( stepY > 0 ? static_cast<float>( row + 1 ) - localY : localY - static_cast<float>( row ) ) * deltaY;
+	}
+
+	for ( ;; ) {
+		if ( nextX < nextY ) {
+			if ( nextX > maximumTime ) {
+				return false;
+			}
+
+			column	+= stepX;
+			hitTime	= nextX;
+			nextX	+= deltaX;
+			axis	= 0;
+		} else {
+			if ( nextY > maximumTime ) {
+				return false;
+			}
+
+			row		+= stepY;
+			hitTime	= nextY;
+			nextY	+= deltaY;
+			axis	= 1;
+		}
+
+		if ( bricks->IsBrickAt( column, row ) ) {
+			return true;
+		}
+
+		//Left the grid and moving away from it
+		if ( ( stepX > 0 && column >= BricksWide ) || ( stepX < 0 && column < 0 ) ||
+			( stepY > 0 && row >= BricksHeigh ) || ( stepY < 0 && row < 0 ) ) {
+			return false;
+		}
+	}
+}//TraceBricks()
+
+Autopilot::Autopilot() :
+	paddleSpeed( AutopilotPaddleSpeed ) {
+}//Ctor()
+
+Autopilot::Autopilot( float paddleSpeed ) :
+	paddleSpeed( paddleSpeed ) {
+}//Ctor()
+
+Autopilot::~Autopilot() {
+}//Dtor()
+
+bool Autopilot::PredictIntercept( const GameplayManager *game, const Ball *ball, float &interceptX, float &interceptTime ) const {
+	auto bricks = game->GetBricks();
+	auto player = game->GetPlayer();
+
+	XMFLOAT2 fieldMin, fieldMax, position;
+	game->GetBalls()->GetFieldBounds( fieldMin, fieldMax );
+	XMStoreFloat2( &position, ball->GetHitBoxCenter() );
+
+	XMFLOAT2 velocity	= ball->Velocity;
+	float radiusX		= ball->HitBoxSize.x * 0.5f;
+	float radiusY		= ball->HitBoxSize.y * 0.5f;
+	float minimumX		= fieldMin.x + radiusX;
+	float maximumX		= fieldMax.x - radiusX;
+	float minimumY		= fieldMin.y + radiusY;
+	float paddleY		= XMVectorGetY( player->GetHitBoxTopLeft() ) - radiusY;
+
+	interceptTime = 0.0f;
+
+	for ( std::uint32_t bounce = 0; bounce < AutopilotMaximumBounces; ++bounce ) {
+		if ( velocity.y > 0.0f && position.y >= paddleY ) {
+			interceptX = position.x;
+			return true;
+		}
+
+		//Axis 0 and 1 reflect x and y, axis 2 is the paddle
+		float	hitTime = FLT_MAX;
+		int		axis	= -1;
+
+		if ( velocity.x > 0.0f ) {
+			hitTime	= std::max<float>( ( maximumX - position.x ) / velocity.x, 0.0f );
+			axis	= 0;
+		} else if ( velocity.x < 0.0f ) {
+			hitTime	= std::max<float>( ( minimumX - position.x ) / velocity.x, 0.0f );
+			axis	= 0;
+		}
+
+		if ( velocity.y < 0.0f ) {
+			float time = std::max<float>( ( minimumY - position.y ) / velocity.y, 0.0f );
+
+			if ( time < hitTime ) {
+				hitTime	= time;
+				axis	= 1;
+			}
+		} else if ( velocity.y > 0.0f ) {
+			float time = ( paddleY - position.y ) / velocity.y;
+
+			if ( time < hitTime ) {
+				hitTime	= time;
+				axis	= 2;
+			}
+		}
+
+		if ( axis < 0 ) {
+			return false;
+		}
+
+		float	brickTime;
+		int		brickAxis;
+
+		if ( TraceBricks( bricks, position, velocity, hitTime, brickTime, brickAxis ) ) {
+			hitTime	= brickTime;
+			axis	= brickAxis;
+		}
+
+		position.x		+= velocity.x * hitTime;
+		position.y		+= velocity.y * hitTime;
+		interceptTime	+= hitTime;
+
+		if ( axis == 2 ) {
+			interceptX = position.x;
+			return true;
+		}
+
+		if ( axis == 0 ) {
+			velocity.x = -velocity.x;
+		} else {
+			velocity.y = -velocity.y;
+		}
+	}
+
+	return false;
+}//PredictIntercept()
+
+//Center of the lowest brick, the nearest one to interceptX if a row has several
+bool Autopilot::FindTarget( const BrickManager *bricks, float interceptX, XMFLOAT2 &target ) const {
+	auto origin = bricks->GetGridOrigin();
+
+	for ( std::int32_t row = BricksHeigh - 1; row >= 0; --row ) {
+		float distance = FLT_MAX;
+
+		for ( std::int32_t column = 0; column < BricksWide; ++column ) {
+			if ( !bricks->IsBrickAt( column, row ) ) {
+				continue;
+			}
+
+			float x = origin.x + ( static_cast<float>( column ) + 0.5f ) * ItemWidth;
+
+			if ( std::fabs( x - interceptX ) < distance ) {
+				distance	= std::fabs( x - interceptX );
+				target.x	= x;
+				target.y	= origin.y + ( static_cast<float>( row ) + 0.5f ) * ItemHeight;
+			}
+		}
+
+		if ( distance < FLT_MAX ) {
+			return true;
+		}
+	}
+
+	return false;
+}//FindTarget()
+
+XMVECTOR Autopilot::GetPlayerDelta( const GameplayManager *game, float elapsedTime ) const {
+	auto balls	= game->GetBalls();
+	auto player	= game->GetPlayer();
+
+	const Ball	*nextBall		= nullptr;
+	float		nextX			= 0.0f;
+	float		nextTime		= FLT_MAX;
+	float		interceptX		= 0.0f;
+	float		interceptTime	= 0.0f;
+
+	for ( std::uint32_t i = 0; i < balls->GetCount(); ++i ) {
+		auto ball = balls->GetBall( i );
+
+		if ( PredictIntercept( game, ball, interceptX, interceptTime ) && interceptTime < nextTime ) {
+			nextBall	= ball;
+			nextX		= interceptX;
+			nextTime	= interceptTime;
+		}
+	}
+
+	if ( !nextBall ) {
+		return XMVectorZero();
+	}
+
+	//Bounce( const Player* ) turns the hit offset from the paddle center into horizontal speed
+	float center		= XMVectorGetX( player->GetHitBoxCenter() );
+	float halfWidth		= player->HitBoxSize.x * 0.5f;
+	float paddleY		= XMVectorGetY( player->GetHitBoxTopLeft() );
+	float offset		= 0.0f;
+	XMFLOAT2 target;
+
+	if ( FindTarget( game->GetBricks(), nextX, target ) && paddleY > target.y ) {
+		float maximumSpeed	= MinimumBallSpeed * AutopilotMaximumAim;
+		float speedX		= std::fabs( nextBall->Velocity.y ) * ( target.x - nextX ) / ( paddleY - target.y );
+
+		speedX = std::max<float>( -maximumSpeed, std::min<float>( speedX, maximumSpeed ) );
+		offset = speedX / MinimumBallSpeed * halfWidth;
+	}
+
+	float maximumStep	= paddleSpeed * elapsedTime;
+	float step			= nextX - offset - center;
+
+	step = std::max<float>( -maximumStep, std::min<float>( step, maximumStep ) );
+	return XMVectorSet( step, 0.0f, 0.0f, 0.0f );
+}//GetPlayerDelta()
@@ -0,0 +1,52 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "GameplayManager.h"
+
+namespace BreakIt {
+	namespace Objects {
+		//NOTE: Computer player for soak tests and attract mode. Every ball is followed through
+		//		wall and brick bounces down to the paddle, the paddle goes to the earliest of
+		//		these intercepts and hits the ball off center so it heads for the lowest brick.
+		class Autopilot {
+		public:
+			explicit Autopilot();
+			explicit Autopilot( float paddleSpeed );
+			~Autopilot();
+
+			//Paddle movement for the next tick, feed it straight into GameplayManager::Update()
+			DirectX::XMVECTOR GetPlayerDelta( const GameplayManager *game, float elapsedTime ) const;
+
+			//Where ( hitbox center x ) and in how many seconds a ball reaches the paddle
+			bool PredictIntercept( const GameplayManager *game, const Ball *ball, float &interceptX, float &interceptTime ) const;
+
+		private:
+			bool FindTarget( const BrickManager *bricks, float interceptX, DirectX::XMFLOAT2 &target ) const;
+
+			float paddleSpeed;
+		};//Autopilot class
+
+	}//Objects namespace
+}//BreakIt namespace
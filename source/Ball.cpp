@@ -81,6 +81,20 @@ Ball::Ball( float x, float y, const std::shared_ptr<WinGame::Graphics::Texture2D
 Ball::~Ball() {
 }//Dtor()
 
+void Ball::Reset( float x, float y ) {
+	Position			= XMFLOAT2( x, y );
+	PreviousPosition	= Position;
+	IsInterpolated		= false;
+	IsVisible			= true;
+	Acceleration		= XMFLOAT2( 0.0f, 0.0f );
+	Velocity			= XMFLOAT2( 0.0f, MinimumBallSpeed );
+	faceTime			= 0.0f;
+	isHit				= false;
+	isInvisible			= false;
+
+	SetPower( 1 );
+}//Reset()
+
 bool Ball::IsBouncy() const {
 	return isBouncy;
 }//IsBouncy()
@@ -129,17 +143,18 @@ void Ball::SetPower( std::uint8_t power ) {
 	}
 }//SetPower()
 
-void Ball::Bounce( const Player *player, FXMVECTOR depth, FXMVECTOR normal ) {
+void Ball::Bounce( XMFLOAT2 &position, XMFLOAT2 &velocity, const Player *player, FXMVECTOR depth, FXMVECTOR normal ) {
 	auto n			= XMVectorClamp( normal, XMVectorNegate( XMVectorSplatOne() ), XMVectorSplatOne() );
 	auto correction = XMVectorMultiply( depth, n );
-	auto pos		= XMLoadFloat2( &Position );
-	auto vel		= XMLoadFloat2( &Velocity );
+	auto pos		= XMLoadFloat2( &position );
+	auto vel		= XMLoadFloat2( &velocity );
 	auto paddleSize = XMLoadFloat2( &player->HitBoxSize );
-	auto distance	= XMVectorSubtract( GetHitBoxCenter(), player->GetHitBoxCenter() );
+	auto center		= XMVectorAdd( XMVectorAdd( pos, XMLoadFloat2( &HitBoxOffset ) ), XMVectorScale( XMLoadFloat2( &HitBoxSize ), 0.5f ) );
+	auto distance	= XMVectorSubtract( center, player->GetHitBoxCenter() );
 	auto maxSpeed	= XMVectorSet( MinimumBallSpeed, MinimumBallSpeed, MinimumBallSpeed, MinimumBallSpeed );
 
 	pos = XMVectorAdd( pos, correction );
-	XMStoreFloat2( &Position, pos );
+	XMStoreFloat2( &position, pos );
 
 	distance = XMVectorDivide( distance, XMVectorScale( paddleSize, 0.5f ) );
 
@@ -156,7 +171,7 @@ void Ball::Bounce( const Player *player, FXMVECTOR depth, FXMVECTOR normal ) {
 		);
 
 	vel = XMVectorClamp( vel, XMVectorNegate( maxSpeed ), maxSpeed );
-	XMStoreFloat2( &Velocity, vel );
+	XMStoreFloat2( &velocity, vel );
 
 	if ( isBouncy && XMVector2Greater( depth, XMVectorZero() ) ) {
 		isHit		= true;
@@ -188,12 +203,12 @@ void Ball::Bounce( const Player *player, FXMVECTOR depth, FXMVECTOR normal ) {
 //	XMStoreFloat2(&Velocity, vel);
 //}//BounceBall()
 
-void Ball::Bounce( FXMVECTOR correction, FXMVECTOR maxDepth, FXMVECTOR maxNormal ) {
+void Ball::Bounce( XMFLOAT2 &position, XMFLOAT2 &velocity, FXMVECTOR correction, FXMVECTOR maxDepth, FXMVECTOR maxNormal ) {
 	auto maxSpeed	= XMVectorSet( MinimumBallSpeed, MinimumBallSpeed, MinimumBallSpeed, MinimumBallSpeed );
-	auto pos		= XMLoadFloat2( &Position );
+	auto pos		= XMLoadFloat2( &position );
 	pos				= XMVectorAdd( pos, correction );
 
-	XMStoreFloat2( &Position, pos );
+	XMStoreFloat2( &position, pos );
 
 	//TODO: We still need to find out how to reflect the Ball according to the Normal.
 	//		There are still some edge cases present where the ball behaves odd. for example
@@ -203,7 +218,7 @@ void Ball::Bounce( FXMVECTOR correction, FXMVECTOR maxDepth, FXMVECTOR maxNormal
 	//		First try would be to take the Velocity Normal into account and make some Dot product
 	//		Calculations to see if it complies according to the maxNormal.
 	//		(Let's hope this will be easy to fix *haha*)
-	auto vel = XMLoadFloat2( &Velocity );
+	auto vel = XMLoadFloat2( &velocity );
 
 	if ( XMVector2GreaterOrEqual( XMVector2Dot( vel, maxNormal ), XMVectorZero() ) ) {
 	} else {
@@ -211,7 +226,7 @@ void Ball::Bounce( FXMVECTOR correction, FXMVECTOR maxDepth, FXMVECTOR maxNormal
 	}
 
 	vel = XMVectorClamp( vel, XMVectorNegate( maxSpeed ), maxSpeed );
-	XMStoreFloat2( &Velocity, vel );
+	XMStoreFloat2( &velocity, vel );
 
 	if ( isBouncy && XMVector2Greater( maxDepth, XMVectorZero() ) ) {
 		isHit		= true;
@@ -235,6 +250,11 @@ void Ball::Update( float elapsedTime, float totalTime ) {
 	XMStoreFloat2( &Velocity, vel );
 	XMStoreFloat2( &Position, pos );
 
+	UpdateFlash( elapsedTime );
+}//Update()
+
+//NOTE: Everything Update() does besides moving, for balls moved by the BallManager integrator
+void Ball::UpdateFlash( float elapsedTime ) {
 	if ( isHit ) {
 		faceTime += elapsedTime;
 
@@ -245,7 +265,45 @@ void Ball::Update( float elapsedTime, float totalTime ) {
 			SetPower( Power );
 		}
 	}
-}//Update()
+}//UpdateFlash()
+
+XMVECTOR Ball::GetDisplacement( float elapsedTime ) const {
+	auto acc = XMLoadFloat2( &Acceleration );
+	auto vel = XMLoadFloat2( &Velocity );
+
+	auto newVel = XMVectorAdd( vel, XMVectorScale( acc, elapsedTime ) );
+	return XMVectorScale( XMVectorAdd( vel, newVel ), elapsedTime );
+}//GetDisplacement()
+
+void Ball::SaveState( SnapshotWriter &writer ) const {
+	writer.Write( Position );
+	writer.Write( Velocity );
+	writer.Write( Acceleration );
+	writer.Write( faceTime );
+	writer.Write( Power );
+	writer.Write( isHit );
+	writer.Write( isInvisible );
+	writer.Write( IsVisible );
+}//SaveState()
+
+void Ball::LoadState( SnapshotReader &reader ) {
+	reader.Read( Position );
+	reader.Read( Velocity );
+	reader.Read( Acceleration );
+	reader.Read( faceTime );
+	reader.Read( Power );
+	reader.Read( isHit );
+	reader.Read( isInvisible );
+	reader.Read( IsVisible );
+
+	//Source rectangle and color follow from power and visibility
+	SetPower( Power );
+	if ( isHit && isBouncy && !isInvisible ) {
+		XMStoreFloat4( &RenderColor, Colors::LightYellow );
+	}
+
+	StorePreviousPosition();
+}//LoadState()
 
 bool Ball::IsRemoveReady( const std::unique_ptr<Ball> &ball ) {
 	return !ball->IsVisible;
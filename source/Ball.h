@@ -24,6 +24,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "Player.h"
+#include "Snapshot.h"
 
 namespace BreakIt {
 	namespace Objects {
@@ -39,10 +40,20 @@ namespace BreakIt {
 			bool			IsInvisible() const;
 			void			SetInvisibility( bool invisible );
 
+			//Puts a pooled ball back into the state a new one would have
+			void Reset( float x, float y );
+
 			virtual void Update( float elapsedTime, float totalTime ) override;
+			void UpdateFlash( float elapsedTime );
+			DirectX::XMVECTOR GetDisplacement( float elapsedTime ) const;
+
+			void SaveState( SnapshotWriter &writer ) const;
+			void LoadState( SnapshotReader &reader );
 
-			void Bounce( DirectX::FXMVECTOR correction, DirectX::FXMVECTOR maxDepth, DirectX::FXMVECTOR maxNormal );
-			void Bounce( const Player *player, DirectX::FXMVECTOR depth, DirectX::FXMVECTOR normal );
+			//NOTE: The BallManager keeps position and velocity of its balls, the bounces work on
+			//		those. Position and Velocity of the ball itself are only a copy of them.
+			void Bounce( DirectX::XMFLOAT2 &position, DirectX::XMFLOAT2 &velocity, DirectX::FXMVECTOR correction, DirectX::FXMVECTOR maxDepth, DirectX::FXMVECTOR maxNormal );
+			void Bounce( DirectX::XMFLOAT2 &position, DirectX::XMFLOAT2 &velocity, const Player *player, DirectX::FXMVECTOR depth, DirectX::FXMVECTOR normal );
 
 			static bool IsRemoveReady( const std::unique_ptr<Ball> &ball );
 
@@ -32,6 +32,153 @@ using namespace WinGame;
 using namespace WinGame::Graphics;
 using namespace DirectX;
 
+const std::uint32_t BallLanes = 4;
+
+//NOTE: Position, velocity and acceleration of every ball in struct of arrays layout, padded
+//		to whole groups of four, so the integrator advances four balls per vector operation.
+//		Entry i belongs to balls[i] and is the master copy of its motion, integration and
+//		collision tests read and write the store only. Position and velocity are published
+//		to the Ball objects once per Update() for drawing, snapshots and other readers.
+struct BallStore {
+	std::vector<float>	PositionX;
+	std::vector<float>	PositionY;
+	std::vector<float>	VelocityX;
+	std::vector<float>	VelocityY;
+	std::vector<float>	AccelerationX;
+	std::vector<float>	AccelerationY;
+	std::uint32_t		Count;
+
+	BallStore() :
+		Count( 0 ) {
+	}//Ctor()
+
+	void Resize( std::uint32_t count ) {
+		auto padded = ( count + BallLanes - 1 ) & ~( BallLanes - 1 );
+
+		Count = count;
+		PositionX.resize( padded );
+		PositionY.resize( padded );
+		VelocityX.resize( padded );
+		VelocityY.resize( padded );
+		AccelerationX.resize( padded );
+		AccelerationY.resize( padded );
+
+		//Padding lanes stay at rest so they never change the displacement maximum
+		for ( auto i = count; i < padded; ++i ) {
+			PositionX[i] = PositionY[i] = VelocityX[i] = VelocityY[i] = AccelerationX[i] = AccelerationY[i] = 0.0f;
+		}
+	}//Resize()
+
+	void Push( const Ball *ball ) {
+		Resize( Count + 1 );
+		Gather( Count - 1, ball );
+	}//Push()
+
+	//Drops the entries of the balls isDead() will collect, in the same order ObjectPool::Collect() keeps
+	template<typename Predicate>
+	void Collect( const std::vector<std::unique_ptr<Ball>> &balls, Predicate isDead ) {
+		std::uint32_t alive = 0;
+
+		for ( std::uint32_t i = 0; i < Count; ++i ) {
+			if ( isDead( balls[i] ) ) {
+				continue;
+			}
+
+			if ( alive != i ) {
+				PositionX[alive]		= PositionX[i];
+				PositionY[alive]		= PositionY[i];
+				VelocityX[alive]		= VelocityX[i];
+				VelocityY[alive]		= VelocityY[i];
+				AccelerationX[alive]	= AccelerationX[i];
+				AccelerationY[alive]	= AccelerationY[i];
+			}
+
+			++alive;
+		}
+
+		Resize( alive );
+	}//Collect()
+
+	XMFLOAT2 GetPosition( std::uint32_t index ) const {
+		return XMFLOAT2( PositionX[index], PositionY[index] );
+	}//GetPosition()
+
+	XMFLOAT2 GetVelocity( std::uint32_t index ) const {
+		return XMFLOAT2( VelocityX[index], VelocityY[index] );
+	}//GetVelocity()
+
+	void SetMotion( std::uint32_t index, const XMFLOAT2 &position, const XMFLOAT2 &velocity ) {
+		PositionX[index] = position.x;
+		PositionY[index] = position.y;
+		VelocityX[index] = velocity.x;
+		VelocityY[index] = velocity.y;
+	}//SetMotion()
+
+	void Gather( std::uint32_t index, const Ball *ball ) {
+		PositionX[index]		= ball->Position.x;
+		PositionY[index]		= ball->Position.y;
+		VelocityX[index]		= ball->Velocity.x;
+		VelocityY[index]		= ball->Velocity.y;
+		AccelerationX[index]	= ball->Acceleration.x;
+		AccelerationY[index]	= ball->Acceleration.y;
+	}//Gather()
+
+	void Publish( std::uint32_t index, Ball *ball ) const {
+		ball->Position.x = PositionX[index];
+		ball->Position.y = PositionY[index];
+		ball->Velocity.x = VelocityX[index];
+		ball->Velocity.y = VelocityY[index];
+	}//Publish()
+
+	//Same integration as Ball::Update(), pos += ( vel + newVel ) * dt
+	void Integrate( float elapsedTime ) {
+		auto dt = XMVectorReplicate( elapsedTime );
+
+		for ( std::uint32_t i = 0; i < Count; i += BallLanes ) {
+			auto px = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &PositionX[i] ) );
+			auto py = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &PositionY[i] ) );
+			auto vx = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &VelocityX[i] ) );
+			auto vy = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &VelocityY[i] ) );
+			auto ax = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &AccelerationX[i] ) );
+			auto ay = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &AccelerationY[i] ) );
+
+			auto newVx = XMVectorMultiplyAdd( ax, dt, vx );
+			auto newVy = XMVectorMultiplyAdd( ay, dt, vy );
+
+			px = XMVectorMultiplyAdd( XMVectorAdd( vx, newVx ), dt, px );
+			py = XMVectorMultiplyAdd( XMVectorAdd( vy, newVy ), dt, py );
+
+			XMStoreFloat4( reinterpret_cast<XMFLOAT4*>( &PositionX[i] ), px );
+			XMStoreFloat4( reinterpret_cast<XMFLOAT4*>( &PositionY[i] ), py );
+			XMStoreFloat4( reinterpret_cast<XMFLOAT4*>( &VelocityX[i] ), newVx );
+			XMStoreFloat4( reinterpret_cast<XMFLOAT4*>( &VelocityY[i] ), newVy );
+		}
+	}//Integrate()
+
+	//Longest distance any ball travels in elapsedTime, see Ball::GetDisplacement()
+	float GetMaximumDisplacement( float elapsedTime ) const {
+		auto dt			= XMVectorReplicate( elapsedTime );
+		auto maximum	= XMVectorZero();
+
+		for ( std::uint32_t i = 0; i < Count; i += BallLanes ) {
+			auto vx = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &VelocityX[i] ) );
+			auto vy = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &VelocityY[i] ) );
+			auto ax = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &AccelerationX[i] ) );
+			auto ay = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &AccelerationY[i] ) );
+
+			auto dx = XMVectorMultiply( XMVectorMultiplyAdd( ax, dt, XMVectorAdd( vx, vx ) ), dt );
+			auto dy = XMVectorMultiply( XMVectorMultiplyAdd( ay, dt, XMVectorAdd( vy, vy ) ), dt );
+
+			maximum = XMVectorMax( maximum, XMVectorMultiplyAdd( dx, dx, XMVectorMultiply( dy, dy ) ) );
+		}
+
+		XMFLOAT4 lanes;
+		XMStoreFloat4( &lanes, maximum );
+		return std::sqrt( std::max<float>( std::max<float>( lanes.x, lanes.y ), std::max<float>( lanes.z, lanes.w ) ) );
+	}//GetMaximumDisplacement()
+
+};//BallStore struct
+
 class BallManager::Impl {
 public:
 	Impl();
@@ -41,6 +188,10 @@ public:
 	std::unique_ptr<Ball>				staticBall;
 	std::shared_ptr<Texture2D>			ballTexture;
 	std::vector<std::unique_ptr<Ball>>	balls;
+	ObjectPool<Ball>					ballPool;
+	BallStore							store;
+	std::vector<float>					stepStartX;
+	std::vector<float>					stepStartY;
 
 	std::vector<std::unique_ptr<GameObject>>	borders;
 	std::unique_ptr<DrawableObject>				wall;
@@ -52,31 +203,72 @@ public:
 	bool			globalVisibility;
 	float			visibleTimer;
 
+#if _DEBUG
+	float			integrateTime;
+	std::uint64_t	integratedBalls;
+	std::uint32_t	integrateUpdates;
+#endif
+
 	//Methods
 	void ResetPowerLevel();
 	void ResetVisibility();
 	void ResetWall();
+	std::unique_ptr<Ball> SpawnBall( float x, float y );
+	void AddBall( std::unique_ptr<Ball> ball );
+	bool StepBall( std::uint32_t index, Ball *ball, Player *player, BrickManager *bricks, CollisionQueue *events, float elapsedTime );
+	void SweepBall( std::uint32_t index, const Ball *ball, const Player *player, const BrickManager *bricks );
 
 };//BallManager::Impl class
 
 BallManager::Impl::Impl() :
+	isWidescreen( false ),
 	staticBall( nullptr ),
 	ballTexture( nullptr ),
 	balls( 0 ),
-	isWidescreen( false ),
+	ballPool(),
 	borders( 0 ),
+	wallActive( false ),
+	wallTimer( 0.0f ),
 	globalPower( 1 ),
 	powerTimer( 0.0f ),
 	globalVisibility( true ),
-	visibleTimer( 0.0f ),
-	wallActive( false ),
-	wallTimer( 0.0f ) {
+	visibleTimer( 0.0f ) {
+#if _DEBUG
+	integrateTime		= 0.0f;
+	integratedBalls		= 0;
+	integrateUpdates	= 0;
+#endif
 }//Ctor()
 
 BallManager::BallManager() :
 	pImpl( new Impl() ) {
 }//Ctor()
 
+//Hitbox of ball at a position of the store, see GameObject::GetHitBoxTopLeft()
+static void GetHitBox( const Ball *ball, const XMFLOAT2 &position, XMVECTOR &minimum, XMVECTOR &maximum ) {
+	minimum = XMVectorAdd( XMLoadFloat2( &position ), XMLoadFloat2( &ball->HitBoxOffset ) );
+	maximum = XMVectorAdd( minimum, XMLoadFloat2( &ball->HitBoxSize ) );
+}//GetHitBox()
+
+std::unique_ptr<Ball> BallManager::Impl::SpawnBall( float x, float y ) {
+	auto ball = ballPool.Acquire();
+
+	if ( ball ) {
+		ball->Reset( x, y );
+	} else {
+		ball = std::make_unique<Ball>( x, y, ballTexture );
+	}
+
+	ball->SetInvisibility( !globalVisibility );
+	ball->SetPower( globalPower );
+	return ball;
+}//SpawnBall()
+
+void BallManager::Impl::AddBall( std::unique_ptr<Ball> ball ) {
+	store.Push( ball.get() );
+	balls.push_back( std::move( ball ) );
+}//AddBall()
+
 void BallManager::Impl::ResetWall() {
 	wallActive	= false;
 	wallTimer	= 0.0f;
@@ -109,6 +301,18 @@ std::uint32_t BallManager::GetCount() const {
 	return static_cast<std::uint32_t>( pImpl->balls.size() );
 }//GetCount()
 
+const Ball* BallManager::GetBall( std::uint32_t index ) const {
+	return index < pImpl->balls.size() ? pImpl->balls[index].get() : nullptr;
+}//GetBall()
+
+//NOTE: The inner edges of the four borders, the area balls can move in
+void BallManager::GetFieldBounds( XMFLOAT2 &minimum, XMFLOAT2 &maximum ) const {
+	minimum.x = XMVectorGetX( pImpl->borders[0]->GetHitBoxTopRight() );
+	minimum.y = XMVectorGetY( pImpl->borders[2]->GetHitBoxBottomLeft() );
+	maximum.x = XMVectorGetX( pImpl->borders[1]->GetHitBoxTopLeft() );
+	maximum.y = XMVectorGetY( pImpl->borders[3]->GetHitBoxTopLeft() );
+}//GetFieldBounds()
+
 void BallManager::Initialize( const std::shared_ptr<Texture2D> &texture, bool widescreen ) {
 	pImpl->isWidescreen = widescreen;
 
@@ -118,6 +322,14 @@ void BallManager::Initialize( const std::shared_ptr<Texture2D> &texture, bool wi
 
 	pImpl->ballTexture = texture;
 	pImpl->balls.clear();
+	pImpl->balls.reserve( BallPoolSize );
+	pImpl->store.Resize( 0 );
+
+	//Pooled balls still point at the previous texture
+	pImpl->ballPool.Clear();
+	pImpl->ballPool.Reserve( BallPoolSize, [&texture]() {
+		return std::make_unique<Ball>( 0.0f, 0.0f, texture );
+	} );
 	pImpl->ResetPowerLevel();
 	pImpl->ResetVisibility();
 
@@ -201,15 +413,13 @@ void BallManager::Resize( bool widescreen ) {
 	}
 
 	if ( pImpl->isWidescreen != widescreen ) {
-		//Move Balls
-		if ( pImpl->isWidescreen && !widescreen ) {
-			for ( auto &ball : pImpl->balls ) {
-				ball->Position.x -= SidebarWidth;
-			}
-		} else if ( !pImpl->isWidescreen && widescreen ) {
-			for ( auto &ball : pImpl->balls ) {
-				ball->Position.x += SidebarWidth;
-			}
+		//Move Balls, they jump there so they are not drawn in between either
+		float offset = widescreen ? SidebarWidth : -SidebarWidth;
+
+		for ( std::uint32_t i = 0; i < GetCount(); ++i ) {
+			pImpl->balls[i]->Position.x	+= offset;
+			pImpl->store.PositionX[i]	+= offset;
+			pImpl->balls[i]->StorePreviousPosition();
 		}
 
 		pImpl->isWidescreen = widescreen;
@@ -233,14 +443,13 @@ void BallManager::AddBall() {
 }
 
 void BallManager::AddBall( float x, float y ) {
-	auto ball = std::make_unique<Ball>(
-		x,
-		y,
-		pImpl->ballTexture
-		);
-	ball->SetInvisibility( !pImpl->globalVisibility );
-	ball->SetPower( pImpl->globalPower );
-	pImpl->balls.push_back( std::move( ball ) );
+	pImpl->AddBall( pImpl->SpawnBall( x, y ) );
+}//AddBall()
+
+void BallManager::AddBall( float x, float y, const XMFLOAT2 &velocity ) {
+	auto ball		= pImpl->SpawnBall( x, y );
+	ball->Velocity	= velocity;
+	pImpl->AddBall( std::move( ball ) );
 }//AddBall()
 
 void BallManager::ActivateWall() {
@@ -253,46 +462,234 @@ void BallManager::SplitBall() {
 		AddBall();
 	}
 
-	auto pos = pImpl->balls[0]->Position;
-	auto vel = pImpl->balls[0]->Velocity;
+	auto pos = pImpl->store.GetPosition( 0 );
+	auto vel = pImpl->store.GetVelocity( 0 );
 
 	for ( int i = 0; i < 2; ++i ) {
-		auto ball = std::make_unique<Ball>(
-			pos.x,
-			pos.y,
-			pImpl->ballTexture
-			);
-		ball->SetInvisibility( !pImpl->globalVisibility );
-		ball->SetPower( pImpl->globalPower );
+		auto ball = pImpl->SpawnBall( pos.x, pos.y );
 		ball->Velocity.x = i == 0 ? vel.x : -vel.x;
 		ball->Velocity.y = i == 0 ? -vel.y : vel.y;
-		pImpl->balls.push_back( std::move( ball ) );
+		pImpl->AddBall( std::move( ball ) );
 	}
 }//SplitBall()
 
+//NOTE: Stress mode, fans count balls out of the field center with the golden angle between
+//		two neighbours so they spread evenly and split up on their first bounces.
+void BallManager::AddStressBalls( std::uint32_t count ) {
+	const float goldenAngle = XM_PI * ( 3.0f - std::sqrt( 5.0f ) );
+
+	float centerX	= GameFieldWidth * 0.5f + SplitterWidth - BallTextureWidth * 0.5f;
+	float centerY	= MaximumBrickHeight + 50.0f;
+
+	if ( pImpl->isWidescreen ) {
+		centerX += SidebarWidth;
+	}
+
+	pImpl->balls.reserve( pImpl->balls.size() + count );
+
+	for ( std::uint32_t i = 0; i < count; ++i ) {
+		float angle = goldenAngle * static_cast<float>( i );
+
+		AddBall( centerX, centerY, XMFLOAT2( std::cos( angle ) * MinimumBallSpeed, std::sin( angle ) * MinimumBallSpeed ) );
+	}
+}//AddStressBalls()
+
 void BallManager::Clear() {
 	pImpl->ResetPowerLevel();
 	pImpl->ResetVisibility();
 	pImpl->ResetWall();
-	pImpl->balls.clear();
+	pImpl->ballPool.CollectAll( pImpl->balls );
+	pImpl->store.Resize( 0 );
 }//Clear()
 
-void BallManager::Update( Player *player, SoundManager *sounds, float elapsedTime, float totalTime ) {
+void BallManager::SaveState( SnapshotWriter &writer ) const {
+	writer.Write( pImpl->wallActive );
+	writer.Write( pImpl->wallTimer );
+	writer.Write( pImpl->globalPower );
+	writer.Write( pImpl->powerTimer );
+	writer.Write( pImpl->globalVisibility );
+	writer.Write( pImpl->visibleTimer );
+	writer.Write( GetCount() );
+
+	for ( const auto &ball : pImpl->balls ) {
+		ball->SaveState( writer );
+	}
+}//SaveState()
+
+void BallManager::LoadState( SnapshotReader &reader ) {
+	std::uint32_t count = 0;
+
+	reader.Read( pImpl->wallActive );
+	reader.Read( pImpl->wallTimer );
+	reader.Read( pImpl->globalPower );
+	reader.Read( pImpl->powerTimer );
+	reader.Read( pImpl->globalVisibility );
+	reader.Read( pImpl->visibleTimer );
+	reader.Read( count );
+
+	pImpl->ballPool.CollectAll( pImpl->balls );
+	pImpl->store.Resize( 0 );
+
+	for ( std::uint32_t i = 0; i < count && reader.IsValid(); ++i ) {
+		auto ball = pImpl->SpawnBall( 0.0f, 0.0f );
+		ball->LoadState( reader );
+		pImpl->AddBall( std::move( ball ) );
+	}
+}//LoadState()
+
+bool BallManager::Impl::StepBall( std::uint32_t index, Ball *ball, Player *player, BrickManager *bricks, CollisionQueue *events, float elapsedTime ) {
 	XMVECTOR depth, normal;
 
 	XMVECTOR maxDepth	= XMVectorZero();
 	XMVECTOR maxNormal	= XMVectorZero();
 	XMVECTOR correction = XMVectorZero();
 
-	bool removeBalls	= false;
-	bool bounceBall		= false;
+	auto position = store.GetPosition( index );
+	auto velocity = store.GetVelocity( index );
+
+	XMVECTOR hitBoxMin, hitBoxMax;
+	GetHitBox( ball, position, hitBoxMin, hitBoxMax );
+
+	bool bounceBall = false;
+
+	ball->UpdateFlash( elapsedTime );
+
+	if ( wallActive && GameObject::IsTouchingBoxes( wall->GetHitBoxTopLeft(), wall->GetHitBoxBottomRight(), hitBoxMin, hitBoxMax, depth, normal ) ) {
+		bounceBall = true;
+		correction = XMVectorAdd( correction, XMVectorMultiply( depth, normal ) );
+
+		if ( XMVector2Greater( depth, maxDepth ) ) {
+			maxDepth	= depth;
+			maxNormal	= normal;
+		}
+
+		events->Push( COLLISION_EVENT::SIDE_HIT );
+	}
+
+	for ( decltype( borders.size() ) i = 0; i < borders.size(); ++i ) {
+		auto borderMin = borders[i]->GetHitBoxTopLeft();
+		auto borderMax = borders[i]->GetHitBoxBottomRight();
+
+		if ( i == 3 && GameObject::IsTouchingBoxes( borderMin, borderMax, hitBoxMin, hitBoxMax ) ) {		//Death Zone
+			//Only the last ball in play costs a life
+			events->Push( COLLISION_EVENT::BALL_LOST, 0, balls.size() == 1 ? 1 : 0 );
+
+			ball->IsVisible = false;
+			return false;
+		} else if ( GameObject::IsTouchingBoxes( borderMin, borderMax, hitBoxMin, hitBoxMax, depth, normal ) ) {
+			bounceBall = true;
+			correction = XMVectorAdd( correction, XMVectorMultiply( depth, normal ) );
+
+			if ( XMVector2Greater( depth, maxDepth ) ) {
+				maxDepth	= depth;
+				maxNormal	= normal;
+			}
+
+			events->Push( COLLISION_EVENT::SIDE_HIT );
+		}
+	}
+		
+	if ( bounceBall ) {
+		ball->Bounce( position, velocity, correction, maxDepth, maxNormal );
+		GetHitBox( ball, position, hitBoxMin, hitBoxMax );
+	}
+
+	if ( GameObject::IsTouchingBoxes( player->GetHitBoxTopLeft(), player->GetHitBoxBottomRight(), hitBoxMin, hitBoxMax, depth, normal ) ) {
+		ball->Bounce( position, velocity, player, depth, normal );
+		events->Push( COLLISION_EVENT::PLAYER_HIT );
+	}
+
+	bricks->CheckCollision( ball, position, velocity, events );
+
+	store.SetMotion( index, position, velocity );
+	return true;
+}//StepBall()
+
+//Keeps the earlier of time and the first contact of a swept hitbox with object, see GameObject::SweepBoxes()
+static void SweepObject( const GameObject *object, const XMFLOAT2 &movingMin, const XMFLOAT2 &movingMax, const XMFLOAT2 &distance, float &time, XMFLOAT2 &normal ) {
+	XMFLOAT2	objectMin, objectMax, hitNormal;
+	float		hitTime;
+
+	XMStoreFloat2( &objectMin, object->GetHitBoxTopLeft() );
+	XMStoreFloat2( &objectMax, object->GetHitBoxBottomRight() );
+
+	if ( GameObject::SweepBoxes( movingMin, movingMax, distance, objectMin, objectMax, hitTime, hitNormal ) && hitTime < time ) {
+		time	= hitTime;
+		normal	= hitNormal;
+	}
+}//SweepObject()
+
+//NOTE: Fallback for capped steps, where a ball may move further than MaximumBallStep at once.
+//		The step of the ball at index is swept from where it started against everything
+//		StepBall() tests, and the ball is stopped SweepContactDepth inside the first thing
+//		in its way. The rest of that step's travel is dropped; StepBall() bounces the ball as usual.
+void BallManager::Impl::SweepBall( std::uint32_t index, const Ball *ball, const Player *player, const BrickManager *bricks ) {
+	XMFLOAT2 start( stepStartX[index], stepStartY[index] );
+	XMFLOAT2 distance(
+		store.PositionX[index] - start.x,
+		store.PositionY[index] - start.y
+		);
+
+	if ( distance.x * distance.x + distance.y * distance.y <= MaximumBallStep * MaximumBallStep ) {
+		return;
+	}
+
+	XMVECTOR hitBoxMin, hitBoxMax;
+	GetHitBox( ball, start, hitBoxMin, hitBoxMax );
+
+	XMFLOAT2 movingMin, movingMax;
+	XMStoreFloat2( &movingMin, hitBoxMin );
+	XMStoreFloat2( &movingMax, hitBoxMax );
+
+	float		time = 1.0f;
+	XMFLOAT2	normal( 0.0f, 0.0f );
+	float		hitTime;
+	XMFLOAT2	hitNormal;
+
+	if ( wallActive ) {
+		SweepObject( wall.get(), movingMin, movingMax, distance, time, normal );
+	}
+
+	for ( auto &border : borders ) {
+		SweepObject( border.get(), movingMin, movingMax, distance, time, normal );
+	}
+
+	SweepObject( player, movingMin, movingMax, distance, time, normal );
+
+	if ( bricks->Sweep( hitBoxMin, hitBoxMax, XMLoadFloat2( &distance ), hitTime, hitNormal ) && hitTime < time ) {
+		time	= hitTime;
+		normal	= hitNormal;
+	}
+
+	if ( time >= 1.0f ) {
+		return;
+	}
+
+	//The normal is axis aligned and faces against the displacement, so this is never zero
+	float approach = std::fabs( normal.x * distance.x + normal.y * distance.y );
+	float fraction = std::min<float>( time + SweepContactDepth / approach, 1.0f );
+
+	store.PositionX[index] = start.x + distance.x * fraction;
+	store.PositionY[index] = start.y + distance.y * fraction;
+}//SweepBall()
+
+void BallManager::StorePreviousPositions() {
+	for ( auto &ball : pImpl->balls ) {
+		ball->StorePreviousPosition();
+	}
+}//StorePreviousPositions()
+
+void BallManager::Update( Player *player, BrickManager *bricks, ISoundObserver *sounds, CollisionQueue *events, float elapsedTime, float totalTime ) {
+	bool removeBalls = false;
 
 	//Wall Timer
 	if ( pImpl->wallActive ) {
 		pImpl->wallTimer += elapsedTime;
 
 		if ( pImpl->wallTimer >= ItemDuration ) {
-			sounds->PlaySound( SOUND_FILE::NEGATIVE_ITEM );
+			if ( sounds ) {
+				sounds->PlaySound( SOUND_FILE::NEGATIVE_ITEM );
+			}
 			pImpl->ResetWall();
 		}
 	}
@@ -302,7 +699,9 @@ void BallManager::Update( Player *player, SoundManager *sounds, float elapsedTim
 		pImpl->visibleTimer += elapsedTime;
 
 		if ( pImpl->visibleTimer >= ItemDuration ) {
-			sounds->PlaySound( SOUND_FILE::POSITIVE_ITEM );
+			if ( sounds ) {
+				sounds->PlaySound( SOUND_FILE::POSITIVE_ITEM );
+			}
 			pImpl->ResetVisibility();
 		}
 	}
@@ -312,10 +711,8 @@ void BallManager::Update( Player *player, SoundManager *sounds, float elapsedTim
 		pImpl->powerTimer += elapsedTime;
 
 		if ( pImpl->powerTimer >= ItemDuration ) {
-			if ( pImpl->globalPower == 0 ) {
-				sounds->PlaySound( SOUND_FILE::POSITIVE_ITEM );
-			} else {
-				sounds->PlaySound( SOUND_FILE::NEGATIVE_ITEM );
+			if ( sounds ) {
+				sounds->PlaySound( pImpl->globalPower == 0 ? SOUND_FILE::POSITIVE_ITEM : SOUND_FILE::NEGATIVE_ITEM );
 			}
 
 			pImpl->ResetPowerLevel();
@@ -328,82 +725,87 @@ void BallManager::Update( Player *player, SoundManager *sounds, float elapsedTim
 		pImpl->borders[1]->GetHitBoxBottomLeft()
 		);
 
-	for ( auto &ball : pImpl->balls ) {
-		ball->Update( elapsedTime, totalTime );
+	auto	store	= &pImpl->store;
+	auto	count	= GetCount();
 
-		bounceBall = false;
+	//NOTE: All balls are moved in as many equal steps as needed for the fastest one to never
+	//		travel further than MaximumBallStep at once. Every step resolves its own impacts, so
+	//		long frames neither let a ball skip over thin objects nor drop any of the bounces.
+	//		Past MaximumBallSubSteps the steps grow longer instead, and SweepBall() catches
+	//		what a ball would otherwise pass through.
+	float distance		= store->GetMaximumDisplacement( elapsedTime );
+	std::uint32_t steps = static_cast<std::uint32_t>( std::ceil( distance / MaximumBallStep ) );
 
-		if ( pImpl->wallActive && pImpl->wall->IsTouching( ball.get(), depth, normal ) ) {
-			bounceBall = true;
-			correction = XMVectorAdd( correction, XMVectorMultiply( depth, normal ) );
+	bool isCapped = steps > MaximumBallSubSteps;
 
-			if ( XMVector2Greater( depth, maxDepth ) ) {
-				maxDepth	= depth;
-				maxNormal	= normal;
-			}
+	steps = std::max<std::uint32_t>( steps, 1U );
+	steps = std::min<std::uint32_t>( steps, MaximumBallSubSteps );
 
-			sounds->PlaySound( SOUND_FILE::SIDE_HIT );
-		}
+	float stepTime = elapsedTime / static_cast<float>( steps );
 
-		for ( decltype( pImpl->borders.size() ) i = 0; i < pImpl->borders.size(); ++i ) {
-			if ( i == 3 && pImpl->borders[i]->IsTouching( ball.get() ) ) {		//Death Zone
+	for ( std::uint32_t step = 0; step < steps; ++step ) {
+#if _DEBUG
+		Utility::BasicTimer integrateTimer;
+#endif
+
+		if ( isCapped ) {
+			pImpl->stepStartX.assign( std::begin( store->PositionX ), std::end( store->PositionX ) );
+			pImpl->stepStartY.assign( std::begin( store->PositionY ), std::end( store->PositionY ) );
+		}
 
-				sounds->PlaySound( SOUND_FILE::BALL_LOST );
-				//player->Points -= static_cast<std::uint32_t>(static_cast<double>(player->Points) * 0.1);
+		store->Integrate( stepTime );
 
-				if ( player->Points > 5 ) {
-					player->Points -= 5;
-				} else {
-					player->Points = 0;
-				}
+#if _DEBUG
+		integrateTimer.Update();
+		pImpl->integrateTime	+= integrateTimer.GetTotalTime();
+		pImpl->integratedBalls	+= count;
+#endif
 
-				if ( player->Health != 0 && pImpl->balls.size() == 1 ) {
-					player->Health--;
-				}
+		for ( std::uint32_t i = 0; i < count; ++i ) {
+			auto ball = pImpl->balls[i].get();
 
-				ball->IsVisible = false;
-				removeBalls		= true;
-			} else if ( pImpl->borders[i]->IsTouching( ball.get(), depth, normal ) ) {
-				bounceBall = true;
-				correction = XMVectorAdd( correction, XMVectorMultiply( depth, normal ) );
+			if ( !ball->IsVisible ) {
+				continue;
+			}
 
-				if ( XMVector2Greater( depth, maxDepth ) ) {
-					maxDepth	= depth;
-					maxNormal	= normal;
-				}
+			if ( isCapped ) {
+				pImpl->SweepBall( i, ball, player, bricks );
+			}
 
-				sounds->PlaySound( SOUND_FILE::SIDE_HIT );
+			if ( !pImpl->StepBall( i, ball, player, bricks, events, stepTime ) ) {
+				removeBalls = true;
 			}
 		}
-		
-		if ( bounceBall ) {
-			ball->Bounce( correction, maxDepth, maxNormal );
-		}
+	}
+
+	for ( std::uint32_t i = 0; i < count; ++i ) {
+		store->Publish( i, pImpl->balls[i].get() );
+	}
 
-		if ( player->IsTouching( ball.get(), depth, normal ) ) {
-			ball->Bounce( player, depth, normal );
-			sounds->PlaySound( SOUND_FILE::PLAYER_HIT );
+#if _DEBUG
+	if ( ++pImpl->integrateUpdates == StressReportInterval ) {
+		if ( pImpl->integrateTime > 0.0f ) {
+			Utility::WriteDebugMessage(
+				L"Integrated %f balls per ms, %u balls in play\n",
+				static_cast<float>( pImpl->integratedBalls ) / ( pImpl->integrateTime * 1000.0f ),
+				count
+				);
 		}
+
+		pImpl->integrateTime	= 0.0f;
+		pImpl->integratedBalls	= 0;
+		pImpl->integrateUpdates	= 0;
 	}
+#endif
 
 	if ( removeBalls ) {
-		pImpl->balls.erase(
-		std::remove_if(
-			std::begin( pImpl->balls ),
-			std::end( pImpl->balls ),
-			Ball::IsRemoveReady
-			),
-		std::end( pImpl->balls )
-		);
+		store->Collect( pImpl->balls, Ball::IsRemoveReady );
+		pImpl->ballPool.Collect( pImpl->balls, Ball::IsRemoveReady );
 	}
 }//Update()
 
-void BallManager::CheckCollision( Player *player, BrickManager *bricks, ItemManager *items, SoundManager *sounds ) {
-	for ( auto &ball : pImpl->balls ) {
-		bricks->CheckCollision( ball.get(), player, sounds, items );
-	}
-}//CheckCollision()
 
+#ifndef BREAKIT_HEADLESS
 void BallManager::Draw( SpriteBatch *batch ) {
 	float offset = pImpl->isWidescreen ? SplitterWidth + SidebarWidth : SplitterWidth;
 
@@ -427,6 +829,7 @@ void BallManager::DrawStatic( SpriteBatch *batch, float x, float y ) {
 	pImpl->staticBall->Position.y = y;
 	pImpl->staticBall->Draw( batch );
 }//DrawStatic()
+#endif
 
 void BallManager::SetPowerLevel( std::uint8_t power ) {
 	pImpl->globalPower	= power;
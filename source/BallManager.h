@@ -26,9 +26,10 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "ItemManager.h"
 #include "Ball.h"
 #include "Player.h"
-#include "SoundManager.h"
+#include "ISoundObserver.h"
 #include "BrickManager.h"
 #include "Globals.h"
+#include "ObjectPool.h"
 
 namespace BreakIt {
 	namespace Objects {
@@ -38,18 +39,26 @@ namespace BreakIt {
 			virtual ~BallManager();
 			UTILITY_CLASS_MOVE( BallManager );
 
-			std::uint32_t GetCount() const;
+			std::uint32_t	GetCount() const;
+			const Ball*		GetBall( std::uint32_t index ) const;
+			void			GetFieldBounds( DirectX::XMFLOAT2 &minimum, DirectX::XMFLOAT2 &maximum ) const;
 
 			void Initialize( const std::shared_ptr<WinGame::Graphics::Texture2D> &texture, bool widescreen );
 			void AddBall( float x, float y );
+			void AddBall( float x, float y, const DirectX::XMFLOAT2 &velocity );
 			void AddBall();
 			void SplitBall();
-			void Update( Player *player, SoundManager *sounds, float elapsedTime, float totalTime );
-			void CheckCollision( Player *player, BrickManager *bricks, ItemManager *items, SoundManager *sounds );
+			void AddStressBalls( std::uint32_t count );
+			void StorePreviousPositions();
+			void Update( Player *player, BrickManager *bricks, ISoundObserver *sounds, CollisionQueue *events, float elapsedTime, float totalTime );
+#ifndef BREAKIT_HEADLESS
 			void Draw( DirectX::SpriteBatch *batch );
 			void DrawStatic( DirectX::SpriteBatch *batch, float x, float y );
+#endif
 			void Clear();
 			void Resize( bool widescreen );
+			void SaveState( SnapshotWriter &writer ) const;
+			void LoadState( SnapshotReader &reader );
 			void SetPowerLevel( std::uint8_t power );
 			void SetVisibility( bool visible );
 			void ActivateWall();
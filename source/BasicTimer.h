@@ -28,7 +28,7 @@ namespace Utility
 	class BasicTimer final {
 	public:
 		explicit BasicTimer() {
-			if ( !QueryPerformanceFrequency( &m_frequency ) ) {
+			if ( !QueryFrequency( &m_frequency ) ) {
 				UTILITY_THROW_EX( E_FAIL );
 			}
 
@@ -68,8 +68,8 @@ namespace Utility
 		}//Reset()
     
 		void Update() {
-			if ( !QueryPerformanceCounter( &m_currentTime ) ) {
-				throw ref new Platform::FailureException();
+			if ( !QueryCounter( &m_currentTime ) ) {
+				UTILITY_THROW_EX( E_FAIL );
 			}
         
 			m_total = static_cast<float>(
@@ -100,12 +100,39 @@ namespace Utility
 
 	private:
 
+#ifdef UTILITY_PORTABLE
+		//NOTE: Mirrors the LARGE_INTEGER member used below, so both builds share the same arithmetic
+		struct Ticks {
+			std::int64_t QuadPart;
+		};//Ticks struct
+
+		static bool QueryFrequency( Ticks *value ) {
+			value->QuadPart = std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num;
+			return true;
+		}//QueryFrequency()
+
+		static bool QueryCounter( Ticks *value ) {
+			value->QuadPart = std::chrono::steady_clock::now().time_since_epoch().count();
+			return true;
+		}//QueryCounter()
+#else
+		typedef LARGE_INTEGER Ticks;
+
+		static bool QueryFrequency( Ticks *value ) {
+			return QueryPerformanceFrequency( value ) != FALSE;
+		}//QueryFrequency()
+
+		static bool QueryCounter( Ticks *value ) {
+			return QueryPerformanceCounter( value ) != FALSE;
+		}//QueryCounter()
+#endif
+
 		float			m_total;
 		float			m_delta;
-		LARGE_INTEGER	m_frequency;
-		LARGE_INTEGER	m_currentTime;
-		LARGE_INTEGER	m_startTime;
-		LARGE_INTEGER	m_lastTime;
+		Ticks			m_frequency;
+		Ticks			m_currentTime;
+		Ticks			m_startTime;
+		Ticks			m_lastTime;
 		
 	};//BasicTimer class
 
@@ -0,0 +1,313 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "BatchSimulator.h"
+#include "Autopilot.h"
+#include "Globals.h"
+#include <cstring>
+#include <mutex>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+using namespace DirectX;
+
+//Games of one worker not yet started, from Begin up to End
+struct WorkRange {
+	std::mutex		Lock;
+	std::uint32_t	Begin;
+	std::uint32_t	End;
+};//WorkRange struct
+
+//NOTE: Work stealing over the game indices. Every worker starts with an even share and plays
+//		it from the front, a worker that runs out takes the back half of the largest range
+//		left. Won games end early and lost ones run to BatchMaximumTicks, so the shares
+//		finish far apart and stealing keeps every core busy until the last game.
+template<typename Function>
+static void ParallelFor( std::uint32_t count, std::uint32_t threadCount, const Function &function ) {
+	threadCount = std::max<std::uint32_t>( std::min<std::uint32_t>( threadCount, count ), 1 );
+
+	std::vector<WorkRange> ranges( threadCount );
+
+	for ( std::uint32_t i = 0; i < threadCount; ++i ) {
+		ranges[i].Begin	= static_cast<std::uint32_t>( static_cast<std::uint64_t>( count ) * i / threadCount );
+		ranges[i].End	= static_cast<std::uint32_t>( static_cast<std::uint64_t>( count ) * ( i + 1 ) / threadCount );
+	}
+
+	auto worker = [&ranges, &function, threadCount]( std::uint32_t self ) {
+		auto &own = ranges[self];
+
+		for ( ;; ) {
+			std::uint32_t	index	= 0;
+			bool			hasWork	= false;
+
+			{
+				std::lock_guard<std::mutex> guard( own.Lock );
+
+				if ( own.Begin < own.End ) {
+					index	= own.Begin++;
+					hasWork	= true;
+				}
+			}
+
+			if ( hasWork ) {
+				function( index );
+				continue;
+			}
+
+			//Own share done, steal from whoever has the most left
+			std::uint32_t victim	= self;
+			std::uint32_t most		= 0;
+
+			for ( std::uint32_t i = 0; i < threadCount; ++i ) {
+				if ( i == self ) {
+					continue;
+				}
+
+				std::lock_guard<std::mutex> guard( ranges[i].Lock );
+
+				if ( ranges[i].End - ranges[i].Begin > most ) {
+					most	= ranges[i].End - ranges[i].Begin;
+					victim	= i;
+				}
+			}
+
+			if ( most == 0 ) {
+				return;
+			}
+
+			std::uint32_t begin, end;
+
+			{
+				std::lock_guard<std::mutex> guard( ranges[victim].Lock );
+
+				//The victim may have moved on since it was picked
+				if ( ranges[victim].Begin >= ranges[victim].End ) {
+					continue;
+				}
+
+				//A single game left is taken whole
+				end					= ranges[victim].End;
+				begin				= ranges[victim].Begin + ( end - ranges[victim].Begin ) / 2;
+				ranges[victim].End	= begin;
+			}
+
+			std::lock_guard<std::mutex> guard( own.Lock );
+			own.Begin	= begin;
+			own.End		= end;
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve( threadCount - 1 );
+
+	for ( std::uint32_t i = 1; i < threadCount; ++i ) {
+		threads.emplace_back( worker, i );
+	}
+
+	//The calling thread is worker 0
+	worker( 0 );
+
+	for ( auto &thread : threads ) {
+		thread.join();
+	}
+}//ParallelFor()
+
+class BatchSimulator::Impl {
+public:
+	Impl();
+
+	std::vector<std::uint8_t>	level;
+	float						tickTime;
+	std::uint32_t				maximumTicks;
+	std::uint32_t				threadCount;
+	bool						isWidescreen;
+	BatchSummary				summary;
+
+	Autopilot autopilot;
+
+	//Methods
+	BatchResult PlayGame( std::uint32_t seed ) const;
+};//BatchSimulator::Impl class
+
+BatchSimulator::Impl::Impl() :
+	tickTime( 1.0f / DefaultTickRate ),
+	maximumTicks( BatchMaximumTicks ),
+	threadCount( 0 ),
+	isWidescreen( false ) {
+
+	std::memset( &summary, 0, sizeof( summary ) );
+}//Ctor()
+
+BatchResult BatchSimulator::Impl::PlayGame( std::uint32_t seed ) const {
+	BatchResult result;
+	std::memset( &result, 0, sizeof( result ) );
+	result.Seed = seed;
+
+	GameplayManager game;
+	game.Initialize( isWidescreen );
+	game.SetSeed( seed );
+	game.Load( level.data(), static_cast<std::uint32_t>( level.size() ) );
+
+	auto player = game.GetPlayer();
+	auto health	= player->Health;
+
+	for ( std::uint32_t tick = 0; tick < maximumTicks; ++tick ) {
+		if ( game.IsGameWon() || game.IsGameLost() ) {
+			break;
+		}
+
+		//A lost ball pauses the level, the autopilot just serves again
+		if ( game.IsGamePaused() ) {
+			game.SetPause( false );
+		}
+
+		game.Update( autopilot.GetPlayerDelta( &game, tickTime ), tickTime, tickTime * static_cast<float>( tick ) );
+
+		if ( player->Health < health ) {
+			result.LivesLost += health - player->Health;
+		}
+
+		health = player->Health;
+		++result.Ticks;
+	}
+
+	result.IsWon			= game.IsGameWon();
+	result.ClearTime		= result.IsWon ? tickTime * static_cast<float>( result.Ticks ) : 0.0f;
+	result.Points			= player->Points;
+	result.ItemsCollected	= game.GetItems()->GetCollectedCount();
+	result.BricksLeft		= game.GetBricks()->GetCount();
+
+	return result;
+}//PlayGame()
+
+BatchSimulator::BatchSimulator() :
+	pImpl( new Impl() ) {
+}//Ctor()
+
+BatchSimulator::~BatchSimulator() {
+}//Dtor()
+
+UTILITY_CLASS_PIMPL_IMPL( BatchSimulator );
+
+void BatchSimulator::SetLevel( const std::uint8_t *pixels, std::uint32_t length ) {
+	pImpl->level.assign( pixels, pixels + length );
+}//SetLevel()
+
+void BatchSimulator::SetTickRate( float ticksPerSecond ) {
+	pImpl->tickTime = 1.0f / std::max<float>( ticksPerSecond, MinimumTickRate );
+}//SetTickRate()
+
+void BatchSimulator::SetMaximumTicks( std::uint32_t ticks ) {
+	pImpl->maximumTicks = ticks;
+}//SetMaximumTicks()
+
+void BatchSimulator::SetWidescreen( bool widescreen ) {
+	pImpl->isWidescreen = widescreen;
+}//SetWidescreen()
+
+void BatchSimulator::SetThreadCount( std::uint32_t threads ) {
+	pImpl->threadCount = threads;
+}//SetThreadCount()
+
+std::uint32_t BatchSimulator::GetThreadCount() const {
+	if ( pImpl->threadCount > 0 ) {
+		return pImpl->threadCount;
+	}
+
+	//hardware_concurrency() may not know and return 0
+	return std::max<std::uint32_t>( std::thread::hardware_concurrency(), 1 );
+}//GetThreadCount()
+
+std::vector<BatchResult> BatchSimulator::Run( std::uint32_t firstSeed, std::uint32_t games ) {
+	std::vector<BatchResult> results( games );
+
+	if ( pImpl->level.empty() ) {
+		return results;
+	}
+
+	Utility::BasicTimer batchTimer;
+	const Impl *impl = pImpl.get();
+
+	//Every game writes only its own slot, so the results need no locking
+	ParallelFor( games, GetThreadCount(), [&results, impl, firstSeed]( std::uint32_t index ) {
+		results[index] = impl->PlayGame( firstSeed + index );
+	} );
+
+	batchTimer.Update();
+
+	pImpl->summary = Summarize( results );
+	pImpl->summary.TicksPerSecond = batchTimer.GetTotalTime() > 0.0f ?
+		static_cast<float>( pImpl->summary.Ticks ) / batchTimer.GetTotalTime() : 0.0f;
+
+#if _DEBUG
+	Utility::WriteDebugMessage(
+		L"Batch: %u games, %u won, %f ticks/s\n",
+		pImpl->summary.Games,
+		pImpl->summary.Wins,
+		pImpl->summary.TicksPerSecond
+		);
+#endif
+
+	return results;
+}//Run()
+
+const BatchSummary& BatchSimulator::GetSummary() const {
+	return pImpl->summary;
+}//GetSummary()
+
+BatchSummary BatchSimulator::Summarize( const std::vector<BatchResult> &results ) {
+	BatchSummary summary;
+	std::memset( &summary, 0, sizeof( summary ) );
+
+	double clearTime	= 0.0;
+	double livesLost	= 0.0;
+	double points		= 0.0;
+	double items		= 0.0;
+
+	for ( const auto &result : results ) {
+		++summary.Games;
+		summary.Ticks += result.Ticks;
+
+		if ( result.IsWon ) {
+			++summary.Wins;
+			clearTime += result.ClearTime;
+		}
+
+		livesLost	+= result.LivesLost;
+		points		+= result.Points;
+		items		+= result.ItemsCollected;
+	}
+
+	if ( summary.Games > 0 ) {
+		summary.AverageLivesLost		= static_cast<float>( livesLost / summary.Games );
+		summary.AveragePoints			= static_cast<float>( points / summary.Games );
+		summary.AverageItemsCollected	= static_cast<float>( items / summary.Games );
+	}
+
+	if ( summary.Wins > 0 ) {
+		summary.AverageClearTime = static_cast<float>( clearTime / summary.Wins );
+	}
+
+	return summary;
+}//Summarize()
@@ -0,0 +1,82 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "GameplayManager.h"
+
+namespace BreakIt {
+	namespace Objects {
+		struct BatchResult {
+			std::uint32_t	Seed;
+			bool			IsWon;
+			std::uint32_t	Ticks;
+			float			ClearTime;
+			std::uint32_t	LivesLost;
+			std::uint32_t	Points;
+			std::uint32_t	ItemsCollected;
+			std::uint32_t	BricksLeft;
+		};//BatchResult struct
+
+		struct BatchSummary {
+			std::uint32_t	Games;
+			std::uint32_t	Wins;
+			std::uint64_t	Ticks;
+			float			AverageClearTime;
+			float			AverageLivesLost;
+			float			AveragePoints;
+			float			AverageItemsCollected;
+			float			TicksPerSecond;
+		};//BatchSummary struct
+
+		//NOTE: Plays many headless games of one level at once with the Autopilot as player and
+		//		one seed per game. Games are spread over std::threads that steal work from each
+		//		other, each game owns its own GameplayManager so nothing is shared between them.
+		class BatchSimulator {
+		public:
+			explicit BatchSimulator();
+			virtual ~BatchSimulator();
+			UTILITY_CLASS_MOVE( BatchSimulator );
+
+			void SetLevel( const std::uint8_t *pixels, std::uint32_t length );
+			void SetTickRate( float ticksPerSecond );
+			void SetMaximumTicks( std::uint32_t ticks );
+			void SetWidescreen( bool widescreen );
+
+			//Threads Run() plays on, the calling one included. 0 uses one per hardware thread.
+			void			SetThreadCount( std::uint32_t threads = 0 );
+			std::uint32_t	GetThreadCount() const;
+
+			std::vector<BatchResult>	Run( std::uint32_t firstSeed, std::uint32_t games );
+			const BatchSummary&			GetSummary() const;
+
+			static BatchSummary Summarize( const std::vector<BatchResult> &results );
+
+		private:
+			UTILITY_CLASS_COPY( BatchSimulator );
+			UTILITY_CLASS_PIMPL();
+
+		};//BatchSimulator class
+
+	}//Objects namespace
+}//BreakIt namespace
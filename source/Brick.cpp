@@ -62,6 +62,7 @@ Brick::Brick( float x, float y, std::uint8_t health, const std::shared_ptr<Textu
 Brick::~Brick() {
 }//Dtor()
 
+#ifndef BREAKIT_HEADLESS
 void Brick::DrawAnimated( SpriteBatch *batch, const RECT &sourceRECT ) {
 	if ( !Texture || !Texture->IsInitialized() || !IsVisible ) {
 		return;
@@ -76,46 +77,30 @@ void Brick::DrawAnimated( SpriteBatch *batch, const RECT &sourceRECT ) {
 
 	batch->Draw( Texture->GetResourceView(), dest, &sourceRECT, XMLoadFloat4( &RenderColor ), XMConvertToRadians( Rotation ), Origin );
 }//DrawAnimated()
+#endif
 
-std::shared_ptr<Brick> Brick::CreateBrickFromColor( std::uint8_t red, std::uint8_t green, std::uint8_t blue ) {
-	auto result = std::make_shared<Brick>();
-
+bool Brick::PropertiesFromColor( std::uint8_t red, std::uint8_t green, std::uint8_t blue, std::uint8_t &health, std::int32_t &points ) {
 	if ( red == 0 && green == 255 && blue == 0 ) {
-		result->Health = 1;
-		result->Points = 1;
-
-		XMStoreFloat4( &result->RenderColor, Brick::RenderColorFromHealth( 1 ) );
-
+		health = 1;
+		points = 1;
 	} else if ( red == 0 && green == 0 && blue == 255 ) {
-		result->Health = 2;
-		result->Points = 2;
-
-		XMStoreFloat4( &result->RenderColor, Brick::RenderColorFromHealth( 2 ) );
-
+		health = 2;
+		points = 2;
 	} else if ( red == 255 && green == 255 && blue == 0 ) {
-		result->Health = 3;
-		result->Points = 3;
-
-		XMStoreFloat4( &result->RenderColor, Brick::RenderColorFromHealth( 3 ) );
-
+		health = 3;
+		points = 3;
 	} else if ( red == 255 && green == 0 && blue == 0 ) {
-		result->Health = 4;
-		result->Points = 4;
-
-		XMStoreFloat4( &result->RenderColor, Brick::RenderColorFromHealth( 4 ) );
-
+		health = 4;
+		points = 4;
 	} else if ( red == 255 && green == 255 && blue == 255 ) {
-		result->Health = MaximumBrickHealth;
-		result->Points = 5;
-
-		XMStoreFloat4( &result->RenderColor, Brick::RenderColorFromHealth( 5 ) );
-
+		health = MaximumBrickHealth;
+		points = 5;
 	} else {
-		return nullptr;
+		return false;
 	}
 
-	return result;
-}//CreateBrickFromColor()
+	return true;
+}//PropertiesFromColor()
 
 XMVECTOR Brick::RenderColorFromHealth( std::int8_t health ) {
 	if ( health == 0 ) {
@@ -132,7 +117,3 @@ XMVECTOR Brick::RenderColorFromHealth( std::int8_t health ) {
 		return Colors::White;
 	}
 }//RenderColorFromHealth()
-
-bool Brick::IsRemoveReady( const std::shared_ptr<Brick> &brick ) {
-	return !brick->IsVisible;
-}//IsRemoveReady()
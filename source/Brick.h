@@ -24,8 +24,11 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "DrawableObject.h"
+
+#ifndef BREAKIT_HEADLESS
 #include "Texture2D.h"
 #include "SpriteBatch.h"
+#endif
 
 namespace BreakIt {
 	namespace Objects {
@@ -35,11 +38,12 @@ namespace BreakIt {
 			Brick( float x, float y, std::uint8_t health, const std::shared_ptr<WinGame::Graphics::Texture2D> &texture );
 			virtual ~Brick();
 
+#ifndef BREAKIT_HEADLESS
 			void DrawAnimated( DirectX::SpriteBatch *batch, const RECT &sourceRECT );
+#endif
 
-			static std::shared_ptr<Brick>	CreateBrickFromColor( std::uint8_t red, std::uint8_t green, std::uint8_t blue );
+			static bool						PropertiesFromColor( std::uint8_t red, std::uint8_t green, std::uint8_t blue, std::uint8_t &health, std::int32_t &points );
 			static DirectX::XMVECTOR		RenderColorFromHealth( std::int8_t health );
-			static bool						IsRemoveReady( const std::shared_ptr<Brick> &brick );
 			
 			std::uint8_t Health;
 			std::int32_t Points;
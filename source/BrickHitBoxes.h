@@ -0,0 +1,140 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "Globals.h"
+#include <cfloat>
+
+namespace BreakIt {
+	namespace Objects {
+		const std::uint32_t BoxLanes = 4;
+
+		//NOTE: Up to four candidate bricks in struct of arrays layout so one hitbox can be tested
+		//		against all of them at once. Unused lanes hold an inverted (empty) box that never touches anything.
+		struct BrickHitBoxes {
+			DirectX::XMFLOAT4		MinX;
+			DirectX::XMFLOAT4		MinY;
+			DirectX::XMFLOAT4		MaxX;
+			DirectX::XMFLOAT4		MaxY;
+			std::uint32_t	Cells[BoxLanes];
+			std::uint32_t	Count;
+
+			BrickHitBoxes() {
+				Clear();
+			}//Ctor()
+
+			void Clear() {
+				MinX	= DirectX::XMFLOAT4( FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX );
+				MinY	= DirectX::XMFLOAT4( FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX );
+				MaxX	= DirectX::XMFLOAT4( -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX );
+				MaxY	= DirectX::XMFLOAT4( -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX );
+				Count	= 0;
+			}//Clear()
+
+			bool IsFull() const {
+				return Count == BoxLanes;
+			}//IsFull()
+
+			void Push( std::uint32_t cell, const DirectX::XMFLOAT2 &topLeft ) {
+				( &MinX.x )[Count]	= topLeft.x;
+				( &MinY.x )[Count]	= topLeft.y;
+				( &MaxX.x )[Count]	= topLeft.x + ItemWidth;
+				( &MaxY.x )[Count]	= topLeft.y + ItemHeight;
+				Cells[Count]		= cell;
+
+				++Count;
+			}//Push()
+
+			//NOTE: Tests a hitbox against all four lanes at once. Per lane this yields the same
+			//		overlap, depth and normal (including the order in which ties are resolved) as
+			//		GameObject::IsTouching() of a brick hitbox against the object. Returns false if no lane is touching.
+			bool IsTouching(
+				DirectX::FXMVECTOR objectMin,
+				DirectX::FXMVECTOR objectMax,
+				DirectX::XMVECTOR &touching,
+				DirectX::XMVECTOR &depth,
+				DirectX::XMVECTOR &normalX,
+				DirectX::XMVECTOR &normalY ) const {
+
+				auto minX = DirectX::XMLoadFloat4( &MinX );
+				auto minY = DirectX::XMLoadFloat4( &MinY );
+				auto maxX = DirectX::XMLoadFloat4( &MaxX );
+				auto maxY = DirectX::XMLoadFloat4( &MaxY );
+
+				auto positiveX = DirectX::XMVectorSubtract( maxX, DirectX::XMVectorSplatX( objectMin ) );
+				auto negativeX = DirectX::XMVectorSubtract( DirectX::XMVectorSplatX( objectMax ), minX );
+				auto positiveY = DirectX::XMVectorSubtract( maxY, DirectX::XMVectorSplatY( objectMin ) );
+				auto negativeY = DirectX::XMVectorSubtract( DirectX::XMVectorSplatY( objectMax ), minY );
+
+				touching = DirectX::XMVectorAndInt(
+					DirectX::XMVectorAndInt( DirectX::XMVectorGreater( positiveX, DirectX::g_XMZero ), DirectX::XMVectorGreater( negativeX, DirectX::g_XMZero ) ),
+					DirectX::XMVectorAndInt( DirectX::XMVectorGreater( positiveY, DirectX::g_XMZero ), DirectX::XMVectorGreater( negativeY, DirectX::g_XMZero ) )
+					);
+
+				if ( DirectX::XMComparisonAllTrue( DirectX::XMVector4EqualIntR( touching, DirectX::XMVectorFalseInt() ) ) ) {
+					return false;
+				}
+
+				auto one		= DirectX::XMVectorSplatOne();
+				auto minusOne	= DirectX::XMVectorNegate( one );
+				auto zero		= DirectX::XMVectorZero();
+
+				depth	= positiveX;
+				normalX = one;
+				normalY = zero;
+
+				auto select = DirectX::XMVectorLess( negativeX, depth );
+				depth		= DirectX::XMVectorSelect( depth, negativeX, select );
+				normalX		= DirectX::XMVectorSelect( normalX, minusOne, select );
+
+				select	= DirectX::XMVectorLess( positiveY, depth );
+				depth	= DirectX::XMVectorSelect( depth, positiveY, select );
+				normalX = DirectX::XMVectorSelect( normalX, zero, select );
+				normalY = DirectX::XMVectorSelect( normalY, one, select );
+
+				select	= DirectX::XMVectorLess( negativeY, depth );
+				depth	= DirectX::XMVectorSelect( depth, negativeY, select );
+				normalX = DirectX::XMVectorSelect( normalX, zero, select );
+				normalY = DirectX::XMVectorSelect( normalY, minusOne, select );
+
+				return true;
+			}//IsTouching()
+
+			bool IsTouching( DirectX::FXMVECTOR objectMin, DirectX::FXMVECTOR objectMax, DirectX::XMVECTOR &touching ) const {
+				auto minX = DirectX::XMLoadFloat4( &MinX );
+				auto minY = DirectX::XMLoadFloat4( &MinY );
+				auto maxX = DirectX::XMLoadFloat4( &MaxX );
+				auto maxY = DirectX::XMLoadFloat4( &MaxY );
+
+				touching = DirectX::XMVectorAndInt(
+					DirectX::XMVectorAndInt( DirectX::XMVectorLess( minX, DirectX::XMVectorSplatX( objectMax ) ), DirectX::XMVectorLess( DirectX::XMVectorSplatX( objectMin ), maxX ) ),
+					DirectX::XMVectorAndInt( DirectX::XMVectorLess( minY, DirectX::XMVectorSplatY( objectMax ) ), DirectX::XMVectorLess( DirectX::XMVectorSplatY( objectMin ), maxY ) )
+					);
+
+				return !DirectX::XMComparisonAllTrue( DirectX::XMVector4EqualIntR( touching, DirectX::XMVectorFalseInt() ) );
+			}//IsTouching()
+		};//BrickHitBoxes struct
+
+	}//Objects namespace
+}//BreakIt namespace
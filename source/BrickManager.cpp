@@ -26,335 +26,397 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "IGameObject.h"
 #include "Globals.h"
 #include "Laser.h"
+#include "BrickHitBoxes.h"
+#include <cfloat>
+#include <cmath>
+#include <cstring>
 
 using namespace DirectX;
 using namespace BreakIt;
 using namespace BreakIt::Objects;
 using namespace WinGame;
 using namespace WinGame::Graphics;
-using namespace WinGame::Audio;
 
-const std::int32_t MaximumObjects = 16;
+const std::uint32_t	CellCount	= BricksWide * BricksHeigh;
+const std::uint32_t	AliveWords	= ( CellCount + 31 ) / 32;
 
-enum class BRICK_ADDITION : std::uint8_t {
-	ADD_FAILED = 0x00U,
-	ADD_SUCCEEDED,
-	ADD_OVERFLOW
-};//BrickAddition enum class
+//Distance between a brick sprite and its hitbox (see Brick::Brick())
+const float BrickHitBoxOffsetX = ( ItemTextureWidth - ItemWidth ) * 0.5f;
+const float BrickHitBoxOffsetY = ( ItemTextureHeight - ItemHeight ) * 0.5f;
 
-class BrickTree : public GameObject {
+//NOTE: The bricks of a level sit on a fixed BricksWide x BricksHeigh lattice whose cells are
+//		exactly one brick hitbox in size. A brick is therefore fully described by its cell,
+//		health and points; its position, hitbox and sprite are derived from the cell on demand.
+//		The cell arrays are stored struct of arrays and walked linearly by every pass.
+class BrickGrid {
 public:
-	std::unique_ptr<BrickTree> NorthWest;
-	std::unique_ptr<BrickTree> NorthEast;
-	std::unique_ptr<BrickTree> SouthWest;
-	std::unique_ptr<BrickTree> SouthEast;
-
-	std::vector<std::shared_ptr<Brick>> Bricks;
-
-	BrickTree( float x, float y, float width, float height ) :
-		GameObject( x, y, width, height ),
-		NorthWest( nullptr ),
-		NorthEast( nullptr ),
-		SouthWest( nullptr ),
-		SouthEast( nullptr ),
-		Bricks() {
+	std::uint8_t	Health[CellCount];
+	std::uint8_t	Points[CellCount];
+	std::uint32_t	Alive[AliveWords];
+	XMFLOAT2		Origin;
+	std::uint32_t	Count;
+
+	BrickGrid() :
+		Origin( 0.0f, 0.0f ),
+		Count( 0 ) {
+		Clear();
 	}//Ctor()
 
-	virtual ~BrickTree() {
-	}//Dtor()
+	bool IsAlive( std::uint32_t cell ) const {
+		return ( Alive[cell >> 5] & ( 1U << ( cell & 31 ) ) ) != 0;
+	}//IsAlive()
 
-	std::uint32_t GetBrickCount() const {
-		std::uint32_t result = static_cast<std::uint32_t>( Bricks.size() );
+	XMFLOAT2 GetHitBoxTopLeft( std::uint32_t cell ) const {
+		return XMFLOAT2(
+			Origin.x + static_cast<float>( cell % BricksWide ) * ItemWidth,
+			Origin.y + static_cast<float>( cell / BricksWide ) * ItemHeight
+			);
+	}//GetHitBoxTopLeft()
 
-		if ( NorthWest ) {
-			result += NorthWest->GetBrickCount();
-			result += NorthEast->GetBrickCount();
-			result += SouthWest->GetBrickCount();
-			result += SouthEast->GetBrickCount();
-		}
-		return result;
-	}//GetBrickCount()
+	XMFLOAT2 GetPosition( std::uint32_t cell ) const {
+		auto topLeft = GetHitBoxTopLeft( cell );
+		return XMFLOAT2( topLeft.x - BrickHitBoxOffsetX, topLeft.y - BrickHitBoxOffsetY );
+	}//GetPosition()
 
-	BRICK_ADDITION Add( const std::shared_ptr<Brick> &brick ) {
-		XMVECTOR depth, normal;
-		XMVECTOR size = XMVectorSet( ItemWidth, ItemHeight, 0.0f, 1.0f );
+	//Places a brick whose sprite is at (x, y) into the cell under its hitbox center
+	bool Add( float x, float y, std::uint8_t health, std::uint8_t points ) {
+		auto column = static_cast<std::int32_t>( std::floor( ( x + BrickHitBoxOffsetX + ItemWidth * 0.5f - Origin.x ) / ItemWidth ) );
+		auto row	= static_cast<std::int32_t>( std::floor( ( y + BrickHitBoxOffsetY + ItemHeight * 0.5f - Origin.y ) / ItemHeight ) );
 
-		if ( !IsTouching( brick.get(), depth, normal ) ) {
-			return BRICK_ADDITION::ADD_FAILED;
+		if ( !Utility::InRange<std::int32_t>( column, 0, BricksWide ) || !Utility::InRange<std::int32_t>( row, 0, BricksHeigh ) ) {
+			return false;
 		}
 
-		if ( XMVector2Less( depth, size ) ) {
-			return BRICK_ADDITION::ADD_OVERFLOW;
-		}
+		Set( static_cast<std::uint32_t>( row * BricksWide + column ), health, points );
+		return true;
+	}//Add()
 
-		if ( !NorthWest && Bricks.size() <= MaximumObjects ) {
-			Bricks.push_back( brick );
-			return BRICK_ADDITION::ADD_SUCCEEDED;
-		}
+	//Fills the cells in row major order straight from 4 byte per pixel map data
+	void Add( const std::uint8_t *pixels, std::uint32_t length ) {
+		auto cells = std::min<std::uint32_t>( length / 4, CellCount );
 
-		if ( !NorthWest ) {
-			Subdivide();
-		}
+		std::uint8_t health;
+		std::int32_t points;
 
-		BRICK_ADDITION result;
-		//XMStoreFloat4(&object->RenderColor, Colors::Red);
-		result = NorthWest->Add( brick );
-		if ( OverflowCheck( result, brick ) ) {
-			return BRICK_ADDITION::ADD_SUCCEEDED;
+		for ( std::uint32_t cell = 0; cell < cells; ++cell, pixels += 4 ) {
+			if ( Brick::PropertiesFromColor( pixels[0], pixels[1], pixels[2], health, points ) ) {
+				Set( cell, health, static_cast<std::uint8_t>( points ) );
+			}
 		}
+	}//Add()
 
-		//XMStoreFloat4(&object->RenderColor, Colors::Green);
-		result = SouthWest->Add( brick );
-		if ( OverflowCheck( result, brick ) ) {
-			return BRICK_ADDITION::ADD_SUCCEEDED;
+	void Set( std::uint32_t cell, std::uint8_t health, std::uint8_t points ) {
+		if ( !IsAlive( cell ) ) {
+			Alive[cell >> 5] |= 1U << ( cell & 31 );
+			++Count;
 		}
 
-		//XMStoreFloat4(&object->RenderColor, Colors::Blue);
-		result = NorthEast->Add( brick );
-		if ( OverflowCheck( result, brick ) ) {
-			return BRICK_ADDITION::ADD_SUCCEEDED;
-		}
+		Health[cell] = health > MaximumBrickHealth ? MaximumBrickHealth : health;
+		Points[cell] = points;
+	}//Set()
 
-		//XMStoreFloat4(&object->RenderColor, Colors::Yellow);
-		result = SouthEast->Add( brick );
-		if ( OverflowCheck( result, brick ) ) {
-			return BRICK_ADDITION::ADD_SUCCEEDED;
+	void Remove( std::uint32_t cell ) {
+		if ( IsAlive( cell ) ) {
+			Alive[cell >> 5] &= ~( 1U << ( cell & 31 ) );
+			Health[cell] = 0;
+			--Count;
 		}
-
-		return BRICK_ADDITION::ADD_FAILED;
-	}//Add()
+	}//Remove()
 
 	void Clear() {
-		Bricks.clear();
-	
-		if ( NorthWest ) {
-			NorthWest->Clear();
-			NorthEast->Clear();
-			SouthWest->Clear();
-			SouthEast->Clear();
-
-			NorthWest = nullptr;
-			NorthEast = nullptr;
-			SouthWest = nullptr;
-			SouthEast = nullptr;
-		}
+		std::memset( Health, 0, sizeof( Health ) );
+		std::memset( Points, 0, sizeof( Points ) );
+		std::memset( Alive, 0, sizeof( Alive ) );
+
+		Count = 0;
 	}//Clear()
 
-	void TranslateX( float x ) {
-		Position.x += x;
+	//Checks cells read back from a snapshot and recounts the live ones, false if a live
+	//brick has a health outside 1..MaximumBrickHealth
+	bool Validate() {
+		const std::uint32_t tailBits = CellCount & 31;
 
-		for ( auto &brick : Bricks ) {
-			brick->Position.x += x;
+		if ( tailBits != 0 ) {
+			Alive[AliveWords - 1] &= ( 1U << tailBits ) - 1U;
 		}
 
-		if ( NorthWest ) {
-			NorthWest->TranslateX( x );
-			NorthEast->TranslateX( x );
-			SouthWest->TranslateX( x );
-			SouthEast->TranslateX( x );
+		Count = 0;
+		for ( std::uint32_t cell = 0; cell < CellCount; ++cell ) {
+			if ( !IsAlive( cell ) ) {
+				continue;
+			}
+
+			if ( Health[cell] == 0 || Health[cell] > MaximumBrickHealth ) {
+				return false;
+			}
+
+			++Count;
 		}
+
+		return true;
+	}//Validate()
+
+	void TranslateX( float x ) {
+		Origin.x += x;
 	}//TranslateX()
 
-	void Draw( SpriteBatch *batch, const RECT &sourceRECT ) {
-		for ( auto &brick : Bricks ) {
-			brick->DrawAnimated( batch, sourceRECT );
+	//Returns the inclusive range of cells covered by a hitbox, false if it misses the grid
+	bool GetCellRange( const GameObject *object, std::int32_t &left, std::int32_t &top, std::int32_t &right, std::int32_t &bottom ) const {
+		XMFLOAT2 topLeft, bottomRight;
+		XMStoreFloat2( &topLeft, object->GetHitBoxTopLeft() );
+		XMStoreFloat2( &bottomRight, object->GetHitBoxBottomRight() );
+
+		return GetCellRange( topLeft, bottomRight, left, top, right, bottom );
+	}//GetCellRange()
+
+	bool GetCellRange( const XMFLOAT2 &topLeft, const XMFLOAT2 &bottomRight, std::int32_t &left, std::int32_t &top, std::int32_t &right, std::int32_t &bottom ) const {
+		left	= static_cast<std::int32_t>( std::floor( ( topLeft.x - Origin.x ) / ItemWidth ) );
+		top		= static_cast<std::int32_t>( std::floor( ( topLeft.y - Origin.y ) / ItemHeight ) );
+		right	= static_cast<std::int32_t>( std::floor( ( bottomRight.x - Origin.x ) / ItemWidth ) );
+		bottom	= static_cast<std::int32_t>( std::floor( ( bottomRight.y - Origin.y ) / ItemHeight ) );
+
+		if ( right < 0 || bottom < 0 || left >= BricksWide || top >= BricksHeigh ) {
+			return false;
 		}
 
-		if ( NorthWest ) {
-			NorthWest->Draw( batch, sourceRECT );
-			NorthEast->Draw( batch, sourceRECT );
-			SouthWest->Draw( batch, sourceRECT );
-			SouthEast->Draw( batch, sourceRECT );
+		left	= std::max<std::int32_t>( left, 0 );
+		top		= std::max<std::int32_t>( top, 0 );
+		right	= std::min<std::int32_t>( right, BricksWide - 1 );
+		bottom	= std::min<std::int32_t>( bottom, BricksHeigh - 1 );
+
+		return true;
+	}//GetCellRange()
+
+	//Earliest contact of a hitbox moved by displacement with any brick, see GameObject::SweepBoxes()
+	bool Sweep( const XMFLOAT2 &topLeft, const XMFLOAT2 &bottomRight, const XMFLOAT2 &displacement, float &time, XMFLOAT2 &normal ) const {
+		XMFLOAT2 sweptTopLeft(
+			topLeft.x + std::min<float>( displacement.x, 0.0f ),
+			topLeft.y + std::min<float>( displacement.y, 0.0f )
+			);
+		XMFLOAT2 sweptBottomRight(
+			bottomRight.x + std::max<float>( displacement.x, 0.0f ),
+			bottomRight.y + std::max<float>( displacement.y, 0.0f )
+			);
+
+		std::int32_t left, top, right, bottom;
+
+		if ( !GetCellRange( sweptTopLeft, sweptBottomRight, left, top, right, bottom ) ) {
+			return false;
 		}
-	}//Draw()
 
-	void Subdivide() {
-		float halfWidth		= Size.x * 0.5f;
-		float halfHeight	= Size.y * 0.5f;
+		bool hit = false;
 
-		NorthWest = std::make_unique<BrickTree>( Position.x, Position.y, halfWidth, halfHeight );
-		NorthEast = std::make_unique<BrickTree>( Position.x + halfWidth, Position.y, halfWidth, halfHeight );
-		SouthWest = std::make_unique<BrickTree>( Position.x, Position.y + halfHeight, halfWidth, halfHeight );
-		SouthEast = std::make_unique<BrickTree>( Position.x + halfWidth, Position.y + halfHeight, halfWidth, halfHeight );
+		for ( std::int32_t row = top; row <= bottom; ++row ) {
+			for ( std::int32_t column = left; column <= right; ++column ) {
+				auto cell = static_cast<std::uint32_t>( row * BricksWide + column );
 
-		decltype( Bricks ) overflow;
-		BRICK_ADDITION result;
+				if ( !IsAlive( cell ) ) {
+					continue;
+				}
 
-		for ( auto &brick : Bricks ) {
-			//XMStoreFloat4(&brick->RenderColor, Colors::Red);
-			result = NorthWest->Add( brick );
+				auto		cellMin = GetHitBoxTopLeft( cell );
+				XMFLOAT2	cellMax( cellMin.x + ItemWidth, cellMin.y + ItemHeight );
+				float		cellTime;
+				XMFLOAT2	cellNormal;
 
-			if ( result == BRICK_ADDITION::ADD_SUCCEEDED ) {
-				continue;
-			} else if ( result == BRICK_ADDITION::ADD_OVERFLOW ) {
-				overflow.push_back( brick );
-				continue;
+				if ( GameObject::SweepBoxes( topLeft, bottomRight, displacement, cellMin, cellMax, cellTime, cellNormal ) && ( !hit || cellTime < time ) ) {
+					hit		= true;
+					time	= cellTime;
+					normal	= cellNormal;
+				}
 			}
+		}
 
-			//XMStoreFloat4(&brick->RenderColor, Colors::Green);
-			result = SouthWest->Add( brick );
-			if ( result == BRICK_ADDITION::ADD_SUCCEEDED ) {
-				continue;
-			} else if ( result == BRICK_ADDITION::ADD_OVERFLOW ) {
-				overflow.push_back( brick );
-				continue;
-			}
+		return hit;
+	}//Sweep()
 
-			//XMStoreFloat4(&brick->RenderColor, Colors::Blue);
-			result = NorthEast->Add( brick );
-			if ( result == BRICK_ADDITION::ADD_SUCCEEDED ) {
-				continue;
-			} else if ( result == BRICK_ADDITION::ADD_OVERFLOW ) {
-				overflow.push_back( brick );
-				continue;
-			}
+#ifndef BREAKIT_HEADLESS
+	void Draw( SpriteBatch *batch, const Texture2D *texture, const RECT &sourceRECT, const XMFLOAT4 *palette ) {
+		if ( !texture || !texture->IsInitialized() ) {
+			return;
+		}
 
-			//XMStoreFloat4(&brick->RenderColor, Colors::Yellow);
-			result = SouthEast->Add( brick );
-			if ( result == BRICK_ADDITION::ADD_SUCCEEDED ) {
-				continue;
-			} else if ( result == BRICK_ADDITION::ADD_OVERFLOW ) {
-				overflow.push_back( brick );
+		auto view = texture->GetResourceView();
+
+		for ( std::uint32_t cell = 0; cell < CellCount; ++cell ) {
+			if ( !IsAlive( cell ) ) {
 				continue;
 			}
+
+			auto position = GetPosition( cell );
+
+			RECT dest = {
+				Utility::ftoi( position.x ),
+				Utility::ftoi( position.y ),
+				Utility::ftoi( position.x + ItemTextureWidth ),
+				Utility::ftoi( position.y + ItemTextureHeight )
+			};
+
+			batch->Draw( view, dest, &sourceRECT, XMLoadFloat4( &palette[Health[cell]] ) );
 		}
+	}//Draw()
+#endif
 
-		Bricks.clear();
-		Bricks = std::move( overflow );
-	}//Subdivide()
+	void CheckCollision( Laser *laser, CollisionQueue *events ) {
+		std::int32_t left, top, right, bottom;
 
-	bool OverflowCheck( BRICK_ADDITION addition, const std::shared_ptr<Brick> &object ) {
-		switch ( addition ) {
-		case BRICK_ADDITION::ADD_OVERFLOW:
-			Bricks.push_back( object );
-			return true;
-		case BRICK_ADDITION::ADD_FAILED:
-			return false;
-		case BRICK_ADDITION::ADD_SUCCEEDED:
-		default:
-			return true;
+		if ( !GetCellRange( laser, left, top, right, bottom ) ) {
+			return;
 		}
-	}//OverflowCheck()
 
-	void CheckCollision( Laser *laser, Player *player, SoundManager *sounds, ItemManager *items ) {
-		bool hit = false;
+		BrickHitBoxes group;
 
-		for ( auto &brick : Bricks ) {
-			if ( brick->IsVisible && brick->IsTouching( laser ) ) {
-				brick->Health = 0;
-				sounds->PlaySound( SOUND_FILE::BRICK_BREAK );
-				player->Points += brick->Points;
-				items->AddItem( brick->Position.x, brick->Position.y );
-				laser->IsVisible = false;
-				brick->IsVisible = false;
-				hit = true;
+		for ( auto y = top; y <= bottom; ++y ) {
+			for ( auto x = left; x <= right; ++x ) {
+				auto cell = static_cast<std::uint32_t>( y * BricksWide + x );
+
+				if ( IsAlive( cell ) ) {
+					group.Push( cell, GetHitBoxTopLeft( cell ) );
+
+					if ( group.IsFull() ) {
+						CheckCollision( group, laser, events );
+						group.Clear();
+					}
+				}
 			}
 		}
 
-		if ( hit ) {
-			Bricks.erase(
-			std::remove_if(
-				std::begin( Bricks ),
-				std::end( Bricks ),
-				Brick::IsRemoveReady
-				),
-			std::end( Bricks )
-			);
+		if ( group.Count != 0 ) {
+			CheckCollision( group, laser, events );
 		}
+	}//CheckCollision()
 
-		//Check Tree Collision
-		if ( NorthWest ) {
-			if ( NorthWest->IsTouching( laser ) ) {
-				NorthWest->CheckCollision( laser, player, sounds, items );
-			}
+	void CheckCollision( const BrickHitBoxes &group, Laser *laser, CollisionQueue *events ) {
+		XMVECTOR touching;
+		XMUINT4 lanes;
 
-			if ( NorthEast->IsTouching( laser ) ) {
-				NorthEast->CheckCollision( laser, player, sounds, items );
-			}
+		if ( !group.IsTouching( laser->GetHitBoxTopLeft(), laser->GetHitBoxBottomRight(), touching ) ) {
+			return;
+		}
 
-			if ( SouthWest->IsTouching( laser ) ) {
-				SouthWest->CheckCollision( laser, player, sounds, items );
-			}
+		XMStoreUInt4( &lanes, touching );
 
-			if ( SouthEast->IsTouching( laser ) ) {
-				SouthEast->CheckCollision( laser, player, sounds, items );
+		for ( std::uint32_t i = 0; i < group.Count; ++i ) {
+			if ( ( &lanes.x )[i] == 0 ) {
+				continue;
 			}
+
+			auto cell		= group.Cells[i];
+			auto position	= GetPosition( cell );
+
+			events->Push( COLLISION_EVENT::BRICK_BREAK, cell, Points[cell], position.x, position.y );
+			laser->IsVisible = false;
+
+			Remove( cell );
 		}
 	}//CheckCollision()
 
-	XMVECTOR CheckCollision( Ball *ball, Player *player, SoundManager *sounds, ItemManager *items, XMVECTOR &maxDepth, XMVECTOR &maxNormal ) {
-		bool hit = false;
-		XMVECTOR depth, normal;
-		XMVECTOR correction = XMVectorZero();
-
-		for ( auto &brick : Bricks ) {
-			if ( brick->IsVisible && brick->IsTouching( ball, depth, normal ) ) {
-				correction = XMVectorAdd( correction, XMVectorMultiply( depth, normal ) );
-
-				//NOTE: We get the biggest Depth and the corresponding Normal and reflect the Ball
-				//		In only that direction. Even the Edge cases are covered that way i a slightly unelegant matter
-				//		but it should be sufficient enough for this game.
-				if ( XMVector2Greater( depth, maxDepth ) ) {
-					maxDepth	= depth;
-					maxNormal	= normal;
-				}
+	bool CheckCollision( FXMVECTOR hitBoxMin, FXMVECTOR hitBoxMax, std::uint8_t power, CollisionQueue *events, XMVECTOR &correction, XMVECTOR &maxDepth, XMVECTOR &maxNormal ) {
+		XMFLOAT2 topLeft, bottomRight;
+		XMStoreFloat2( &topLeft, hitBoxMin );
+		XMStoreFloat2( &bottomRight, hitBoxMax );
 
-				if ( brick->Health != 0	) {
-					if ( ball->GetPower() >= brick->Health ) {
-						brick->Health = 0;
-					} else {
-						brick->Health -= ball->GetPower();
-					}
+		std::int32_t left, top, right, bottom;
 
-					XMStoreFloat4( &brick->RenderColor, Brick::RenderColorFromHealth( brick->Health ) );
-				}
+		if ( !GetCellRange( topLeft, bottomRight, left, top, right, bottom ) ) {
+			return false;
+		}
 
-				if ( brick->Health == 0 ) {
-					sounds->PlaySound( SOUND_FILE::BRICK_BREAK );
-					player->Points += brick->Points;
-					items->AddItem( brick->Position.x, brick->Position.y );
-					brick->IsVisible = false;
-					hit = true;
-				} else {
-					sounds->PlaySound( SOUND_FILE::BRICK_HIT );
+		BrickHitBoxes group;
+		bool touched = false;
+
+		for ( auto y = top; y <= bottom; ++y ) {
+			for ( auto x = left; x <= right; ++x ) {
+				auto cell = static_cast<std::uint32_t>( y * BricksWide + x );
+
+				if ( IsAlive( cell ) ) {
+					group.Push( cell, GetHitBoxTopLeft( cell ) );
+
+					if ( group.IsFull() ) {
+						touched |= CheckCollision( group, hitBoxMin, hitBoxMax, power, events, correction, maxDepth, maxNormal );
+						group.Clear();
+					}
 				}
 			}
-		}//foreach(brick)
-
-		if ( hit ) {
-			Bricks.erase(
-			std::remove_if(
-				std::begin( Bricks ),
-				std::end( Bricks ),
-				Brick::IsRemoveReady
-				),
-			std::end( Bricks )
-			);
 		}
 
-		//Check Tree Collision
-		if ( NorthWest ) {
-			if ( NorthWest->IsTouching( ball ) ) {
-				correction = XMVectorAdd( correction, NorthWest->CheckCollision( ball, player, sounds, items, maxDepth, maxNormal ) );
+		if ( group.Count != 0 ) {
+			touched |= CheckCollision( group, hitBoxMin, hitBoxMax, power, events, correction, maxDepth, maxNormal );
+		}
+
+		return touched;
+	}//CheckCollision()
+
+	bool CheckCollision(
+		const BrickHitBoxes &group,
+		FXMVECTOR hitBoxMin,
+		FXMVECTOR hitBoxMax,
+		std::uint8_t power,
+		CollisionQueue *events,
+		XMVECTOR &correction,
+		XMVECTOR &maxDepth,
+		XMVECTOR &maxNormal ) {
+
+		XMVECTOR depth, normal;
+		XMVECTOR touching, depths, normalsX, normalsY;
+
+		XMUINT4		lanes;
+		XMFLOAT4	laneDepth;
+		XMFLOAT4	laneNormalX;
+		XMFLOAT4	laneNormalY;
+
+		if ( !group.IsTouching( hitBoxMin, hitBoxMax, touching, depths, normalsX, normalsY ) ) {
+			return false;
+		}
+
+		XMStoreUInt4( &lanes, touching );
+		XMStoreFloat4( &laneDepth, depths );
+		XMStoreFloat4( &laneNormalX, normalsX );
+		XMStoreFloat4( &laneNormalY, normalsY );
+
+		for ( std::uint32_t i = 0; i < group.Count; ++i ) {
+			if ( ( &lanes.x )[i] == 0 ) {
+				continue;
 			}
 
-			if ( NorthEast->IsTouching( ball ) ) {
-				correction = XMVectorAdd( correction, NorthEast->CheckCollision( ball, player, sounds, items, maxDepth, maxNormal ) );
+			auto cell		= group.Cells[i];
+			auto &health	= Health[cell];
+
+			depth	= XMVectorReplicate( ( &laneDepth.x )[i] );
+			normal	= XMVectorSet( ( &laneNormalX.x )[i], ( &laneNormalY.x )[i], 0.0f, 0.0f );
+
+			correction = XMVectorAdd( correction, XMVectorMultiply( depth, normal ) );
+
+			//NOTE: We get the biggest Depth and the corresponding Normal and reflect the Ball
+			//		In only that direction. Even the Edge cases are covered that way i a slightly unelegant matter
+			//		but it should be sufficient enough for this game.
+			if ( XMVector2Greater( depth, maxDepth ) ) {
+				maxDepth	= depth;
+				maxNormal	= normal;
 			}
 
-			if ( SouthWest->IsTouching( ball ) ) {
-				correction = XMVectorAdd( correction, SouthWest->CheckCollision( ball, player, sounds, items, maxDepth, maxNormal ) );
+			if ( health != 0 ) {
+				if ( power >= health ) {
+					health = 0;
+				} else {
+					health -= power;
+				}
 			}
 
-			if ( SouthEast->IsTouching( ball ) ) {
-				correction = XMVectorAdd( correction, SouthEast->CheckCollision( ball, player, sounds, items, maxDepth, maxNormal ) );
+			if ( health == 0 ) {
+				auto position = GetPosition( cell );
+
+				events->Push( COLLISION_EVENT::BRICK_BREAK, cell, Points[cell], position.x, position.y );
+				Remove( cell );
+			} else {
+				events->Push( COLLISION_EVENT::BRICK_HIT, cell );
 			}
 		}
 
-		return correction;
+		return true;
 	}//CheckCollision()
 
-};//BrickTree class
+};//BrickGrid class
 
 class BrickManager::Impl {
 public:
@@ -364,22 +426,28 @@ public:
 
 	std::shared_ptr<Texture2D>	brickTexture;
 	std::unique_ptr<Brick>		staticBrick;
-	std::unique_ptr<BrickTree>	brickTree;
+	std::unique_ptr<BrickGrid>	brickGrid;
 
 	std::vector<RECT>	frames;
 	std::uint32_t		frame;
 	float				time;
 	float				animatedTime;
+
+	XMFLOAT4 palette[MaximumBrickHealth + 1];
 };//BrickManager::Impl class
 
 BrickManager::Impl::Impl() :
-	brickTexture( nullptr ),
 	isWidescreen( false ),
+	brickTexture( nullptr ),
+	brickGrid( new BrickGrid() ),
 	frames( 0 ),
 	frame( 0 ),
 	time( 0.0f ),
-	animatedTime( 0.0f ),
-	brickTree( nullptr ) {
+	animatedTime( 0.0f ) {
+
+	for ( std::int8_t health = 0; health <= MaximumBrickHealth; ++health ) {
+		XMStoreFloat4( &palette[health], Brick::RenderColorFromHealth( health ) );
+	}
 }//Ctor()
 
 BrickManager::BrickManager() :
@@ -393,9 +461,21 @@ BrickManager::~BrickManager() {
 UTILITY_CLASS_PIMPL_IMPL( BrickManager );
 
 std::uint32_t BrickManager::GetCount() const {
-	return pImpl->brickTree->GetBrickCount();
+	return pImpl->brickGrid->Count;
 }//GetCount()
 
+bool BrickManager::IsBrickAt( std::int32_t column, std::int32_t row ) const {
+	if ( !Utility::InRange<std::int32_t>( column, 0, BricksWide ) || !Utility::InRange<std::int32_t>( row, 0, BricksHeigh ) ) {
+		return false;
+	}
+
+	return pImpl->brickGrid->IsAlive( static_cast<std::uint32_t>( row * BricksWide + column ) );
+}//IsBrickAt()
+
+XMFLOAT2 BrickManager::GetGridOrigin() const {
+	return pImpl->brickGrid->Origin;
+}//GetGridOrigin()
+
 void BrickManager::Initialize( const std::shared_ptr<Texture2D> &texture, bool widescreen ) {
 	pImpl->isWidescreen = widescreen;
 
@@ -432,17 +512,9 @@ void BrickManager::Initialize( const std::shared_ptr<Texture2D> &texture, bool w
 		pImpl->frames.push_back( brickRECT );
 	}
 
-	if ( pImpl->brickTree ) {
-		pImpl->brickTree->Clear();
-		pImpl->brickTree = nullptr;
-	}
-
-	pImpl->brickTree = std::make_unique<BrickTree>(
-		widescreen ? SplitterWidth + SidebarWidth : SplitterWidth,
-		0.0f,
-		GameFieldWidth,
-		MaximumBrickHeight
-		);
+	pImpl->brickGrid->Clear();
+	pImpl->brickGrid->Origin.x = widescreen ? SplitterWidth + SidebarWidth : SplitterWidth;
+	pImpl->brickGrid->Origin.y = 0.0f;
 
 	Resize( widescreen );
 }//Initialize()
@@ -450,9 +522,9 @@ void BrickManager::Initialize( const std::shared_ptr<Texture2D> &texture, bool w
 void BrickManager::Resize( bool widescreen ) {
 	if ( pImpl->isWidescreen != widescreen ) {
 		if ( pImpl->isWidescreen && !widescreen ) {
-			pImpl->brickTree->TranslateX( -SidebarWidth );
+			pImpl->brickGrid->TranslateX( -SidebarWidth );
 		} else if ( !pImpl->isWidescreen && widescreen ) {
-			pImpl->brickTree->TranslateX( SidebarWidth );
+			pImpl->brickGrid->TranslateX( SidebarWidth );
 		}
 
 		pImpl->isWidescreen = widescreen;
@@ -460,28 +532,62 @@ void BrickManager::Resize( bool widescreen ) {
 }//Resize()
 
 void BrickManager::Clear() {
-	pImpl->brickTree->Clear();
+	pImpl->brickGrid->Clear();
 }//Clear()
 
-void BrickManager::AddBrick( float x, float y, std::uint8_t red, std::uint8_t green, std::uint8_t blue ) {
-	auto brick = Brick::CreateBrickFromColor( red, green, blue );
+//NOTE: Only the cells are stored, the grid origin follows the current screen layout
+void BrickManager::SaveState( SnapshotWriter &writer ) const {
+	auto grid = pImpl->brickGrid.get();
+
+	writer.Write( grid->Health, sizeof( grid->Health ) );
+	writer.Write( grid->Points, sizeof( grid->Points ) );
+	writer.Write( grid->Alive, sizeof( grid->Alive ) );
+	writer.Write( grid->Count );
+	writer.Write( pImpl->frame );
+	writer.Write( pImpl->time );
+	writer.Write( pImpl->animatedTime );
+}//SaveState()
+
+void BrickManager::LoadState( SnapshotReader &reader ) {
+	auto grid = pImpl->brickGrid.get();
+
+	reader.Read( grid->Health, sizeof( grid->Health ) );
+	reader.Read( grid->Points, sizeof( grid->Points ) );
+	reader.Read( grid->Alive, sizeof( grid->Alive ) );
+	reader.Read( grid->Count );
+	reader.Read( pImpl->frame );
+	reader.Read( pImpl->time );
+	reader.Read( pImpl->animatedTime );
+
+	//NOTE: The stored count is only kept for the layout, Validate() recounts from the bits
+	if ( reader.IsValid() && !grid->Validate() ) {
+		reader.Invalidate();
+	}
+
+	if ( !reader.IsValid() ) {
+		grid->Clear();
+	}
+
+	if ( !reader.IsValid() || pImpl->frame >= pImpl->frames.size() ) {
+		pImpl->frame = 0;
+	}
+}//LoadState()
 
-	if ( brick ) {
-		brick->Position.x	= x;
-		brick->Position.y	= y;
-		brick->Texture		= pImpl->brickTexture;
+void BrickManager::AddBrick( float x, float y, std::uint8_t red, std::uint8_t green, std::uint8_t blue ) {
+	std::uint8_t health;
+	std::int32_t points;
 
-		BRICK_ADDITION result = pImpl->brickTree->Add( brick );
-		if ( result == BRICK_ADDITION::ADD_FAILED ) {
+	if ( Brick::PropertiesFromColor( red, green, blue, health, points ) ) {
+		if ( !pImpl->brickGrid->Add( x, y, health, static_cast<std::uint8_t>( points ) ) ) {
 			UTILITY_DEBUG_MSG( L"UH-OH!" );
-		} else if ( result == BRICK_ADDITION::ADD_OVERFLOW ) {
-			pImpl->brickTree->Bricks.push_back( brick );
 		}
-
-		brick = nullptr;
 	}
 }//AddBrick()
 
+void BrickManager::AddBricks( const std::uint8_t *pixels, std::uint32_t length ) {
+	pImpl->brickGrid->Add( pixels, length );
+}//AddBricks()
+
 void BrickManager::Animate( float elapsedTime ) {
 	if ( pImpl->time >= 3.0f ) {
 		pImpl->animatedTime += elapsedTime;
@@ -501,8 +607,9 @@ void BrickManager::Animate( float elapsedTime ) {
 	}
 }//Animate()
 
+#ifndef BREAKIT_HEADLESS
 void BrickManager::Draw( SpriteBatch *batch ) {
-	pImpl->brickTree->Draw( batch, pImpl->frames[pImpl->frame] );
+	pImpl->brickGrid->Draw( batch, pImpl->brickTexture.get(), pImpl->frames[pImpl->frame], pImpl->palette );
 }//Draw()
 
 void BrickManager::DrawStatic( SpriteBatch *batch, float x, float y, std::uint8_t health ) {
@@ -513,21 +620,32 @@ void BrickManager::DrawStatic( SpriteBatch *batch, float x, float y, std::uint8_
 
 	pImpl->staticBrick->DrawAnimated( batch, pImpl->frames[pImpl->frame] );
 }//DrawStatic()
+#endif
 
-void BrickManager::CheckCollision( Ball *ball, Player *player, SoundManager *sounds, ItemManager *items ) {
-	if ( pImpl->brickTree->IsTouching( ball ) ) {
-		XMVECTOR maxDepth	= XMVectorZero();
-		XMVECTOR maxNormal	= XMVectorZero();
-		XMVECTOR correction = pImpl->brickTree->CheckCollision( ball, player, sounds, items, maxDepth, maxNormal );
+bool BrickManager::Sweep( FXMVECTOR hitBoxMin, FXMVECTOR hitBoxMax, FXMVECTOR displacement, float &time, XMFLOAT2 &normal ) const {
+	XMFLOAT2 topLeft, bottomRight, distance;
+	XMStoreFloat2( &topLeft, hitBoxMin );
+	XMStoreFloat2( &bottomRight, hitBoxMax );
+	XMStoreFloat2( &distance, displacement );
 
+	return pImpl->brickGrid->Sweep( topLeft, bottomRight, distance, time, normal );
+}//Sweep()
+
+void BrickManager::CheckCollision( Ball *ball, XMFLOAT2 &position, XMFLOAT2 &velocity, CollisionQueue *events ) {
+	XMVECTOR maxDepth	= XMVectorZero();
+	XMVECTOR maxNormal	= XMVectorZero();
+	XMVECTOR correction = XMVectorZero();
+
+	auto hitBoxMin = XMVectorAdd( XMLoadFloat2( &position ), XMLoadFloat2( &ball->HitBoxOffset ) );
+	auto hitBoxMax = XMVectorAdd( hitBoxMin, XMLoadFloat2( &ball->HitBoxSize ) );
+
+	if ( pImpl->brickGrid->CheckCollision( hitBoxMin, hitBoxMax, ball->GetPower(), events, correction, maxDepth, maxNormal ) ) {
 		if ( ball->IsBouncy() ) {
-			ball->Bounce( correction, maxDepth, maxNormal );
+			ball->Bounce( position, velocity, correction, maxDepth, maxNormal );
 		}
 	}
 }//CheckCollision()
 
-void BrickManager::CheckCollision( Laser *shot, Player *player, SoundManager *sounds, ItemManager *items ) {
-	if ( pImpl->brickTree->IsTouching( shot ) ) {
-		pImpl->brickTree->CheckCollision( shot, player, sounds, items );
-	}
+void BrickManager::CheckCollision( Laser *shot, CollisionQueue *events ) {
+	pImpl->brickGrid->CheckCollision( shot, events );
 }//CheckCollision()
@@ -25,9 +25,9 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Brick.h"
 #include "Ball.h"
-#include "Sound.h"
 #include "Player.h"
 #include "ItemManager.h"
+#include "CollisionQueue.h"
 
 namespace BreakIt {
 	namespace Objects {	
@@ -41,15 +41,27 @@ namespace BreakIt {
 
 			std::uint32_t GetCount() const;
 
+			//Brick field lookup, cells are ItemWidth x ItemHeight and row 0 starts at the origin
+			bool				IsBrickAt( std::int32_t column, std::int32_t row ) const;
+			DirectX::XMFLOAT2	GetGridOrigin() const;
+
 			void Initialize( const std::shared_ptr<WinGame::Graphics::Texture2D> &texture, bool widescreen );
 			void Animate( float elapsedTime );
+#ifndef BREAKIT_HEADLESS
 			void Draw( DirectX::SpriteBatch *batch );
 			void DrawStatic( DirectX::SpriteBatch *batch, float x, float y, std::uint8_t health );
+#endif
 			void Clear();
 			void Resize( bool widescreen );
+			void SaveState( SnapshotWriter &writer ) const;
+			void LoadState( SnapshotReader &reader );
 			void AddBrick( float x, float y, std::uint8_t red, std::uint8_t green, std::uint8_t blue );
-			void CheckCollision(Ball *ball, Player *player, SoundManager *sounds, ItemManager *items );
-			void CheckCollision(Laser *shot, Player *player, SoundManager *sounds, ItemManager *items );
+			void AddBricks( const std::uint8_t *pixels, std::uint32_t length );
+			void CheckCollision( Laser *shot, CollisionQueue *events );
+
+			//NOTE: Balls are tested at the position the BallManager keeps for them, see Ball::Bounce()
+			void CheckCollision( Ball *ball, DirectX::XMFLOAT2 &position, DirectX::XMFLOAT2 &velocity, CollisionQueue *events );
+			bool Sweep( DirectX::FXMVECTOR hitBoxMin, DirectX::FXMVECTOR hitBoxMax, DirectX::FXMVECTOR displacement, float &time, DirectX::XMFLOAT2 &normal ) const;
 
 		private:
 			UTILITY_CLASS_COPY( BrickManager );
@@ -0,0 +1,79 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "CollisionQueue.h"
+#include "Globals.h"
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+
+//Every brick breaking at once is the most one tick can produce
+const std::uint32_t CollisionQueueCapacity = BricksWide * BricksHeigh;
+
+CollisionQueue::CollisionQueue() :
+	events( 0 ) {
+
+	events.reserve( CollisionQueueCapacity );
+	Reset();
+}//Ctor()
+
+CollisionQueue::~CollisionQueue() {
+}//Dtor()
+
+void CollisionQueue::Push( COLLISION_EVENT type, std::uint32_t cell, std::uint32_t value, float x, float y ) {
+	CollisionEvent collision;
+
+	collision.Type			= type;
+	collision.Cell			= static_cast<std::uint16_t>( cell );
+	collision.Value			= value;
+	collision.Position.x	= x;
+	collision.Position.y	= y;
+
+	events.push_back( collision );
+	++totals[static_cast<std::uint32_t>( type )];
+}//Push()
+
+void CollisionQueue::Clear() {
+	events.clear();
+}//Clear()
+
+void CollisionQueue::Reset() {
+	events.clear();
+
+	for ( auto &total : totals ) {
+		total = 0;
+	}
+}//Reset()
+
+std::uint32_t CollisionQueue::GetCount() const {
+	return static_cast<std::uint32_t>( events.size() );
+}//GetCount()
+
+const CollisionEvent& CollisionQueue::GetEvent( std::uint32_t index ) const {
+	return events[index];
+}//GetEvent()
+
+std::uint64_t CollisionQueue::GetTotal( COLLISION_EVENT type ) const {
+	return totals[static_cast<std::uint32_t>( type )];
+}//GetTotal()
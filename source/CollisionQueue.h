@@ -0,0 +1,69 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace BreakIt {
+	namespace Objects {
+		enum class COLLISION_EVENT : std::uint8_t {
+			BRICK_HIT = 0x00U,
+			BRICK_BREAK,
+			SIDE_HIT,
+			PLAYER_HIT,
+			BALL_LOST,
+			COUNT
+		};//COLLISION_EVENT enum class
+
+		//NOTE: Value holds the points of a broken brick and 1 for a lost ball that costs a life.
+		//		Position is the top left corner of the brick, items spawn there.
+		struct CollisionEvent {
+			COLLISION_EVENT		Type;
+			std::uint16_t		Cell;
+			std::uint32_t		Value;
+			DirectX::XMFLOAT2	Position;
+		};//CollisionEvent struct
+
+		//NOTE: Collision tests only record what happened, sounds, points and item drops
+		//		are applied by the GameplayManager after the physics of a tick are done.
+		//		The events of the last tick stay readable until the next one starts, the
+		//		totals count every event since the last Reset().
+		class CollisionQueue {
+		public:
+			explicit CollisionQueue();
+			~CollisionQueue();
+
+			void Push( COLLISION_EVENT type, std::uint32_t cell = 0, std::uint32_t value = 0, float x = 0.0f, float y = 0.0f );
+			void Clear();
+			void Reset();
+
+			std::uint32_t			GetCount() const;
+			const CollisionEvent&	GetEvent( std::uint32_t index ) const;
+			std::uint64_t			GetTotal( COLLISION_EVENT type ) const;
+
+		private:
+			std::vector<CollisionEvent>	events;
+			std::uint64_t				totals[static_cast<std::uint32_t>( COLLISION_EVENT::COUNT )];
+		};//CollisionQueue class
+
+	}//Objects namespace
+}//BreakIt namespace
@@ -36,6 +36,8 @@ public:
 	std::map<std::wstring, std::shared_ptr<Sound>>					soundList;
 	std::map<std::wstring, std::shared_ptr<Music>>					musicList;
 	std::map<std::wstring, std::shared_ptr<DirectX::SpriteFont>>	fontList;
+
+	std::shared_ptr<const AssetPack> assetPack;
 };//ContentManager::Impl class
 
 ContentManager::Impl::Impl() {
@@ -51,9 +53,24 @@ ContentManager::~ContentManager() {
 
 UTILITY_CLASS_PIMPL_IMPL( ContentManager );
 
+void ContentManager::SetAssetPack( std::shared_ptr<const AssetPack> pack ) {
+	pImpl->assetPack = pack;
+}//SetAssetPack()
+
+std::shared_ptr<const AssetData> ContentManager::LoadAsset( const wchar_t *filename ) const {
+	if ( !pImpl->assetPack ) {
+		return nullptr;
+	}
+
+	return pImpl->assetPack->Load( filename );
+}//LoadAsset()
+
 std::shared_ptr<DirectX::SpriteFont> ContentManager::LoadFont( const GraphicsManager *graphics, const wchar_t *filename ) {
 	if ( pImpl->fontList[filename] == nullptr ) {
-		pImpl->fontList[filename] = graphics->CreateSpriteFont( filename );
+		auto asset = LoadAsset( filename );
+
+		//The font copies what it needs, the asset can go right after
+		pImpl->fontList[filename] = asset ? graphics->CreateSpriteFont( asset->GetData(), asset->GetSize() ) : graphics->CreateSpriteFont( filename );
 	}
 
 	return pImpl->fontList[filename];
@@ -61,7 +78,9 @@ std::shared_ptr<DirectX::SpriteFont> ContentManager::LoadFont( const GraphicsMan
 
 std::shared_ptr<Texture2D> ContentManager::LoadTexture2D( const GraphicsManager *graphics, const wchar_t *filename ) {
 	if ( pImpl->textureList[filename] == nullptr ) {
-		pImpl->textureList[filename] = graphics->CreateTexture2D( filename );
+		auto asset = LoadAsset( filename );
+
+		pImpl->textureList[filename] = asset ? graphics->CreateTexture2D( filename, asset->GetData(), asset->GetSize(), asset ) : graphics->CreateTexture2D( filename );
 	}
 
 	return pImpl->textureList[filename];
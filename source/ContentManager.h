@@ -25,6 +25,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "GraphicsManager.h"
 #include "AudioManager.h"
+#include "AssetPack.h"
 
 namespace WinGame {
 	namespace Content {
@@ -35,6 +36,13 @@ namespace WinGame {
 
 			UTILITY_CLASS_MOVE( ContentManager );
 
+			//NOTE: With a pack set textures and fonts are created from the mapped pack, anything
+			//		it does not contain is still loaded from its own file. nullptr goes back to files only.
+			void SetAssetPack( std::shared_ptr<const AssetPack> pack );
+
+			//Returns nullptr without a pack or if the pack does not contain the file
+			std::shared_ptr<const AssetData> LoadAsset( const wchar_t *filename ) const;
+
 			std::shared_ptr<Graphics::Texture2D> LoadTexture2D(
 				const Graphics::GraphicsManager *graphics, 
 				const wchar_t *filename
@@ -30,14 +30,20 @@ using namespace DirectX;
 using namespace BreakIt;
 using namespace BreakIt::Objects;
 
+float DrawableObject::renderInterpolation = 1.0f;
+
 DrawableObject::DrawableObject() :
 	GameObject(),
-	IDrawableObject() {
+	IDrawableObject(),
+	PreviousPosition( 0.0f, 0.0f ),
+	IsInterpolated( false ) {
 }//Ctor()
 
 DrawableObject::DrawableObject( float x, float y, float width, float height ) :
 	GameObject( x, y, width, height ),
-	IDrawableObject() {
+	IDrawableObject(),
+	PreviousPosition( x, y ),
+	IsInterpolated( false ) {
 
 	SourceRect.left		= 0;
 	SourceRect.top		= 0;
@@ -47,12 +53,19 @@ DrawableObject::DrawableObject( float x, float y, float width, float height ) :
 
 DrawableObject::DrawableObject( float x, float y, float width, float height, const std::shared_ptr<Texture2D> &texture ) :
 	GameObject( x, y, width, height ),
-	IDrawableObject() {
+	IDrawableObject(),
+	PreviousPosition( x, y ),
+	IsInterpolated( false ) {
 
 	SourceRect.left		= 0;
 	SourceRect.top		= 0;
+#ifndef BREAKIT_HEADLESS
 	SourceRect.right	= texture && texture->IsInitialized() ? texture->GetWidth() : Utility::ftoi( width );
 	SourceRect.bottom	= texture && texture->IsInitialized() ? texture->GetHeight() : Utility::ftoi( height );
+#else
+	SourceRect.right	= Utility::ftoi( width );
+	SourceRect.bottom	= Utility::ftoi( height );
+#endif
 
 	Texture = texture;
 }//Ctor()
@@ -60,16 +73,19 @@ DrawableObject::DrawableObject( float x, float y, float width, float height, con
 DrawableObject::~DrawableObject() {
 }//Dtor()
 
+#ifndef BREAKIT_HEADLESS
 void DrawableObject::Draw( SpriteBatch *batch ) {
 	if ( !Texture || !Texture->IsInitialized() || !IsVisible ) {
 		return;
 	}
 
+	auto pos = GetRenderPosition();
+
 	RECT dest = {
-		Utility::ftoi( Position.x ),
-		Utility::ftoi( Position.y ),
-		Utility::ftoi( Position.x + Size.x ),
-		Utility::ftoi( Position.y + Size.y )
+		Utility::ftoi( pos.x ),
+		Utility::ftoi( pos.y ),
+		Utility::ftoi( pos.x + Size.x ),
+		Utility::ftoi( pos.y + Size.y )
 	};
 
 	batch->Draw( Texture->GetResourceView(), dest, &SourceRect, XMLoadFloat4( &RenderColor ), XMConvertToRadians( Rotation ), Origin );
@@ -93,3 +109,27 @@ void DrawableObject::Draw( SpriteBatch *batch ) {
 
 	//batch->Draw(Texture->GetResourceView(), dest2, &source, XMLoadFloat4(&RenderColor), XMConvertToRadians(Rotation), Origin);
 }//Draw()
+#endif
+
+void DrawableObject::StorePreviousPosition() {
+	PreviousPosition	= Position;
+	IsInterpolated		= true;
+}//StorePreviousPosition()
+
+XMFLOAT2 DrawableObject::GetRenderPosition() const {
+	if ( !IsInterpolated ) {
+		return Position;
+	}
+
+	XMFLOAT2 pos;
+	XMStoreFloat2(
+		&pos,
+		XMVectorLerp( XMLoadFloat2( &PreviousPosition ), XMLoadFloat2( &Position ), renderInterpolation )
+		);
+
+	return pos;
+}//GetRenderPosition()
+
+void DrawableObject::SetRenderInterpolation( float interpolation ) {
+	renderInterpolation = interpolation;
+}//SetRenderInterpolation()
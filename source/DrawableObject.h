@@ -35,7 +35,24 @@ namespace BreakIt {
 			DrawableObject( float x, float y, float width, float height, const std::shared_ptr<WinGame::Graphics::Texture2D> &texture );
 			virtual ~DrawableObject();
 
+#ifndef BREAKIT_HEADLESS
 			virtual void Draw( DirectX::SpriteBatch *batch ) override;
+#endif
+
+			//NOTE: Objects that call StorePreviousPosition() at the start of every simulation tick
+			//		are drawn between their previous and current position. Everything else is
+			//		drawn exactly at Position.
+			void				StorePreviousPosition();
+			DirectX::XMFLOAT2	GetRenderPosition() const;
+
+			static void SetRenderInterpolation( float interpolation );
+
+		protected:
+			DirectX::XMFLOAT2	PreviousPosition;
+			bool				IsInterpolated;
+
+		private:
+			static float renderInterpolation;
 
 		};//DrawableObject class
 
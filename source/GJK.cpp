@@ -26,11 +26,10 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 using namespace DirectX;
 
-bool Utility::GJKSimplexCheck( std::vector<XMFLOAT3>& simplex, XMVECTOR& direction ) {
+bool Utility::GJKSimplexCheck( Utility::Simplex& simplex, XMVECTOR& direction ) {
 	XMVECTOR S0, S1, SN;
 
-	auto a	= simplex.back();
-	SN		= XMLoadFloat3( &a );
+	SN		= XMLoadFloat3( &simplex.back() );
 	S0		= XMLoadFloat3( &simplex[0] );
 	S1		= XMLoadFloat3( &simplex[1] );
 
@@ -47,7 +46,7 @@ bool Utility::GJKSimplexCheck( std::vector<XMFLOAT3>& simplex, XMVECTOR& directi
 			XMVector2Dot( acPrep, ao ), 
 			g_XMZero
 			) ) {
-			simplex.erase( std::begin( simplex ) + 1 );
+			simplex.erase( 1 );
 			direction = acPrep;
 		} else {
 			if ( XMVector2Less(
@@ -56,7 +55,7 @@ bool Utility::GJKSimplexCheck( std::vector<XMFLOAT3>& simplex, XMVECTOR& directi
 				) ) {
 				return true;
 			} else {
-				simplex.erase( std::begin( simplex ) );
+				simplex.erase( 0 );
 				direction = abPrep;
 			}
 		}
@@ -76,7 +75,7 @@ bool Utility::GJKSimplexCheck( std::vector<XMFLOAT3>& simplex, XMVECTOR& directi
 	return false;
 }//GJKSimplexCheck()
 
-void Utility::EPAFindClosestEdge( std::vector<XMFLOAT3>& simplex, Utility::SIMPLEX_WINDING winding, XMVECTOR& depth, XMVECTOR& normal, unsigned int& index )
+void Utility::EPAFindClosestEdge( const Utility::Simplex& simplex, Utility::SIMPLEX_WINDING winding, XMVECTOR& depth, XMVECTOR& normal, unsigned int& index )
 {
 	auto size = simplex.size();
 	depth = g_FltMax;
@@ -30,6 +30,64 @@ namespace Utility
 		COUNTER_CLOCKWISE
 	};//SIMPLEX_WINDING enumeration
 
+	//EPA adds one point per iteration to the initial GJK triangle
+	const unsigned int EPAMaximumIterations	= 100;
+	const unsigned int SimplexCapacity		= 3 + EPAMaximumIterations;
+
+	//NOTE: Fixed capacity point storage for the GJK simplex and the EPA polytope.
+	//		Lives on the stack so a collision query never touches the heap.
+	struct Simplex {
+		DirectX::XMFLOAT3	Points[SimplexCapacity];
+		unsigned int		Count;
+
+		Simplex() :
+			Count( 0 ) {
+		}//Ctor()
+
+		unsigned int size() const {
+			return Count;
+		}//size()
+
+		DirectX::XMFLOAT3& operator[]( unsigned int index ) {
+			return Points[index];
+		}
+
+		const DirectX::XMFLOAT3& operator[]( unsigned int index ) const {
+			return Points[index];
+		}
+
+		const DirectX::XMFLOAT3& back() const {
+			return Points[Count - 1];
+		}//back()
+
+		void push_back( const DirectX::XMFLOAT3 &point ) {
+			if ( Count < SimplexCapacity ) {
+				Points[Count++] = point;
+			}
+		}//push_back()
+
+		void insert( unsigned int index, const DirectX::XMFLOAT3 &point ) {
+			if ( Count >= SimplexCapacity ) {
+				return;
+			}
+
+			for ( unsigned int i = Count; i > index; --i ) {
+				Points[i] = Points[i - 1];
+			}
+
+			Points[index] = point;
+			++Count;
+		}//insert()
+
+		void erase( unsigned int index ) {
+			for ( unsigned int i = index + 1; i < Count; ++i ) {
+				Points[i - 1] = Points[i];
+			}
+
+			--Count;
+		}//erase()
+	};//Simplex struct
+
 	inline DirectX::XMVECTOR TripleProduct( DirectX::FXMVECTOR v1, DirectX::FXMVECTOR v2, DirectX::FXMVECTOR v3 ) {
 		auto a = DirectX::XMVectorMultiply(
 			v2, 
@@ -44,7 +102,7 @@ namespace Utility
 		return DirectX::XMVectorSubtract( a, b );
 	}//TripleProduct()
  
-	inline SIMPLEX_WINDING GetSimplexWinding( std::vector<DirectX::XMFLOAT3>& simplex ) {
+	inline SIMPLEX_WINDING GetSimplexWinding( const Simplex& simplex ) {
 		auto size = simplex.size();
 
 		DirectX::XMVECTOR abCross;
@@ -70,11 +128,11 @@ namespace Utility
 	}//GetSimplexWinding()
 
 	void EPAFindClosestEdge(
-		std::vector<DirectX::XMFLOAT3>& simplex, 
+		const Simplex& simplex, 
 		SIMPLEX_WINDING winding, 
 		DirectX::XMVECTOR& depth, 
 		DirectX::XMVECTOR& normal, 
 		unsigned int& index );
 
-	bool GJKSimplexCheck( std::vector<DirectX::XMFLOAT3>& simplex, DirectX::XMVECTOR& direction );
+	bool GJKSimplexCheck( Simplex& simplex, DirectX::XMVECTOR& direction );
 }//Utility namespace
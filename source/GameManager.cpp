@@ -26,6 +26,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "SnappedState.h"
 #include "GameplayManager.h"
 #include "BasicStyle.h"
+#include "Globals.h"
 
 using namespace WinGame;
 using namespace WinGame::Game;
@@ -47,6 +48,11 @@ public:
 	std::int32_t	fpsCounter;
 	float			fpsTime;
 
+	float			tickTime;
+	float			tickAccumulator;
+	float			tickTotalTime;
+	std::uint32_t	maximumTicks;
+
 	std::vector<std::unique_ptr<GameState>> gameStates;
 	std::unique_ptr<GraphicsManager>		graphicsManager;
 	std::unique_ptr<InputManager>			inputManager;
@@ -62,11 +68,16 @@ public:
 	std::unique_ptr<ddHighscore> highscore;
 
 	void UpdateFPS();
+	void UpdateTicks();
 };//GameManager::Impl class
 
 GameManager::Impl::Impl() :
 	isActive( true ),
-	isSnapped( false ) {
+	isSnapped( false ),
+	tickTime( 1.0f / DefaultTickRate ),
+	tickAccumulator( 0.0f ),
+	tickTotalTime( 0.0f ),
+	maximumTicks( MaximumTicksPerFrame ) {
 }//Ctor()
 
 void GameManager::Impl::UpdateFPS() {
@@ -80,6 +91,29 @@ void GameManager::Impl::UpdateFPS() {
 	}
 }//UpdateFPS()
 
+void GameManager::Impl::UpdateTicks() {
+	tickAccumulator += basicTimer->GetDeltaTime();
+
+	std::uint32_t ticks = 0;
+	while ( tickAccumulator >= tickTime && ticks < maximumTicks ) {
+		gameStates.back()->FixedUpdate( tickTime, tickTotalTime );
+
+		tickAccumulator	-= tickTime;
+		tickTotalTime	+= tickTime;
+		++ticks;
+
+		if ( gameStates.empty() ) {
+			return;
+		}
+	}
+
+	//NOTE: Catching up on more than maximumTicks would make the next frame even longer,
+	//		so the simulation rather falls behind real time than spiral down.
+	if ( tickAccumulator >= tickTime ) {
+		tickAccumulator = std::fmod( tickAccumulator, tickTime );
+	}
+}//UpdateTicks()
+
 GameManager::GameManager() :
 	pImpl( new Impl() ),
 	isResumed( false ) {
@@ -131,6 +165,31 @@ int GameManager::GetFPS() const {
 	return pImpl->fps;
 }//GetFPS()
 
+float GameManager::GetTickRate() const {
+	return 1.0f / pImpl->tickTime;
+}//GetTickRate()
+
+float GameManager::GetTickTime() const {
+	return pImpl->tickTime;
+}//GetTickTime()
+
+float GameManager::GetInterpolation() const {
+	return pImpl->tickAccumulator / pImpl->tickTime;
+}//GetInterpolation()
+
+std::uint32_t GameManager::GetMaximumTicks() const {
+	return pImpl->maximumTicks;
+}//GetMaximumTicks()
+
+void GameManager::SetTickRate( float ticksPerSecond ) {
+	pImpl->tickTime			= 1.0f / std::max<float>( ticksPerSecond, MinimumTickRate );
+	pImpl->tickAccumulator	= 0.0f;
+}//SetTickRate()
+
+void GameManager::SetMaximumTicks( std::uint32_t ticks ) {
+	pImpl->maximumTicks = std::max<std::uint32_t>( ticks, 1U );
+}//SetMaximumTicks()
+
 ddHighscore* GameManager::GetHighscore() {
 	return pImpl->highscore.get();
 }
@@ -163,11 +222,21 @@ void GameManager::Initialize( Windows::UI::Core::CoreWindow ^gameWindow, float w
 	pImpl->menuContent->Unload();
 	pImpl->gameContent->Unload();
 
+	//One mapping serves both content managers, without a pack everything comes from loose files
+	auto assetPack	= std::make_shared<AssetPack>();
+	auto packPath	= Platform::String::Concat( Windows::ApplicationModel::Package::Current->InstalledLocation->Path, "\\" );
+
+	if ( assetPack->Open( Platform::String::Concat( packPath, ref new Platform::String( AssetPackFilename.c_str() ) )->Data() ) ) {
+		pImpl->menuContent->SetAssetPack( assetPack );
+		pImpl->gameContent->SetAssetPack( assetPack );
+	}
+
 	pImpl->virtualResolution	= std::make_unique<VirtualResolution>( width, height );
 	pImpl->levelManager			= std::make_unique<GameplayManager>();
 	
 	pImpl->inputManager->Initialize();
 	pImpl->audioManager->Initialize();
+	pImpl->audioManager->SetMusicCacheFolder( Windows::Storage::ApplicationData::Current->LocalFolder->Path->Data() );
 	pImpl->graphicsManager->Initialize( gameWindow, Windows::Graphics::Display::DisplayProperties::LogicalDpi );
 	pImpl->spriteBatch = pImpl->graphicsManager->CreateSpriteBatch();
 	//pImpl->levelManager->Initialize();
@@ -221,6 +290,11 @@ bool GameManager::Run( bool isWindowVisible ) {
 				return false;
 			}
 
+			pImpl->UpdateTicks();
+			if ( pImpl->gameStates.empty() ) {
+				return false;
+			}
+
 			if ( !pImpl->graphicsManager->IsInitialized() ) {
 				return false;
 			}
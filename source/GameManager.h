@@ -55,6 +55,11 @@ namespace WinGame {
 			virtual void Update( float elapsedTime, float totalTime )	= 0;
 			virtual void Draw( float elapsedTime, float totalTime )		= 0;
 
+			//NOTE: Called zero or more times per frame with a constant tickTime, right after
+			//		Update(). Simulation belongs here, Update() is left for input and GUI.
+			virtual void FixedUpdate( float tickTime, float totalTime ) {
+			}//FixedUpdate()
+
 			template<typename T>
 			static std::unique_ptr<GameState> Create() {
 				static_assert( std::is_base_of<GameState, T>::value, "T has to be derived from type [GameState]." );
@@ -109,6 +114,13 @@ namespace WinGame {
 
 			int GetFPS() const;
 
+			float			GetTickRate() const;
+			float			GetTickTime() const;
+			float			GetInterpolation() const;
+			std::uint32_t	GetMaximumTicks() const;
+			void			SetTickRate( float ticksPerSecond );
+			void			SetMaximumTicks( std::uint32_t ticks );
+
 			void Initialize( Windows::UI::Core::CoreWindow ^gameWindow, float width = 1024.0f, float height = 768.0f );
 			bool Run( bool isWindowVisible );
 			void Suspend();
@@ -90,28 +90,26 @@ XMVECTOR GameObject::GetHitBoxBottomRight() const {
 	return XMVectorAdd( p, s );
 }//GetBottomRight()
 
-XMVECTOR GameObject::GetFarthestPoint( DirectX::FXMVECTOR direction ) const {
-	auto vecs = std::vector<XMFLOAT3>( 3 );
-
-	XMStoreFloat3( &vecs[0], GetHitBoxTopRight() );
-	XMStoreFloat3( &vecs[1], GetHitBoxBottomLeft() );
-	XMStoreFloat3( &vecs[2], GetHitBoxBottomRight() );
+bool GameObject::IsAxisAligned() const {
+	return true;
+}//IsAxisAligned()
 
-	/*vecs[0] =;
-	vecs[1] = GetHitBoxBottomLeft();
-	vecs[2] = GetHitBoxBottomRight();*/
+XMVECTOR GameObject::GetFarthestPoint( DirectX::FXMVECTOR direction ) const {
+	const XMVECTOR vecs[3] = {
+		GetHitBoxTopRight(),
+		GetHitBoxBottomLeft(),
+		GetHitBoxBottomRight()
+	};
 	
 	auto ret	= GetHitBoxTopLeft();
 	auto proj	= XMVector2Dot( direction, ret );
 	auto max	= proj;
 
-	XMVECTOR tmp;
-	for ( auto &vec : vecs ) {
-		tmp		= XMLoadFloat3( &vec );
-		proj	= XMVector2Dot( direction, tmp );
+	for ( const auto &vec : vecs ) {
+		proj = XMVector2Dot( direction, vec );
 
 		if ( XMVector2Greater( proj, max ) ) {
-			ret = tmp;
+			ret = vec;
 			max = proj;
 		}
 	}
@@ -127,7 +125,7 @@ DirectX::XMVECTOR GameObject::MinkowskiSupport( const GameObject *other, DirectX
 }//MinkowskiSupport()
 
 void GameObject::EPAPenetration(
-	std::vector<XMFLOAT3> &simplex,
+	Utility::Simplex &simplex,
 	const GameObject *other,
 	XMVECTOR &penetrationDepth,
 	XMVECTOR &penetrationNormal ) const {
@@ -145,7 +143,7 @@ void GameObject::EPAPenetration(
 	n = XMVectorZero();
 	p = XMVectorZero();
 
-	for ( std::int16_t i = 0; i < 100; ++i ) {
+	for ( unsigned int i = 0; i < Utility::EPAMaximumIterations; ++i ) {
 		Utility::EPAFindClosestEdge( simplex, winding, d, n, index );
 
 		p		= MinkowskiSupport( other, n );
@@ -158,7 +156,7 @@ void GameObject::EPAPenetration(
 		}
 
 		XMStoreFloat3( &tp, p );
-		simplex.insert( std::begin( simplex ) + index, tp );
+		simplex.insert( index, tp );
 	}
 
 #if _DEBUG
@@ -169,8 +167,142 @@ void GameObject::EPAPenetration(
 	penetrationDepth	= XMVector2Dot( p, n );
 }//EPAPenetration()
 
+bool GameObject::IsTouchingAABB( const GameObject *other ) const {
+	return IsTouchingBoxes( GetHitBoxTopLeft(), GetHitBoxBottomRight(), other->GetHitBoxTopLeft(), other->GetHitBoxBottomRight() );
+}//IsTouchingAABB()
+
+bool GameObject::IsTouchingAABB( const GameObject *other, XMVECTOR &penetrationDepth, XMVECTOR &penetrationNormal ) const {
+	return IsTouchingBoxes(
+		GetHitBoxTopLeft(),
+		GetHitBoxBottomRight(),
+		other->GetHitBoxTopLeft(),
+		other->GetHitBoxBottomRight(),
+		penetrationDepth,
+		penetrationNormal
+		);
+}//IsTouchingAABB()
+
+bool GameObject::IsTouchingBoxes( FXMVECTOR aMin, FXMVECTOR aMax, FXMVECTOR bMin, GXMVECTOR bMax ) {
+	return XMVector2Less( aMin, bMax ) && XMVector2Less( bMin, aMax );
+}//IsTouchingBoxes()
+
+bool GameObject::IsTouchingBoxes( FXMVECTOR aMin, FXMVECTOR aMax, FXMVECTOR bMin, GXMVECTOR bMax, XMVECTOR &penetrationDepth, XMVECTOR &penetrationNormal ) {
+	//NOTE: The Minkowski difference of two boxes is a box again. These are the distances
+	//		from the origin to its right/bottom (positive) and left/top (negative) edges,
+	//		which is exactly what EPA converges to for box shapes.
+	auto positive = XMVectorSubtract( aMax, bMin );
+	auto negative = XMVectorSubtract( bMax, aMin );
+
+	if ( !XMVector2Greater( positive, g_XMZero ) || !XMVector2Greater( negative, g_XMZero ) ) {
+		return false;
+	}
+
+	XMFLOAT2 pos, neg;
+	XMStoreFloat2( &pos, positive );
+	XMStoreFloat2( &neg, negative );
+
+	float depth = pos.x;
+	penetrationNormal = XMVectorSet( 1.0f, 0.0f, 0.0f, 0.0f );
+
+	if ( neg.x < depth ) {
+		depth				= neg.x;
+		penetrationNormal	= XMVectorSet( -1.0f, 0.0f, 0.0f, 0.0f );
+	}
+
+	if ( pos.y < depth ) {
+		depth				= pos.y;
+		penetrationNormal	= XMVectorSet( 0.0f, 1.0f, 0.0f, 0.0f );
+	}
+
+	if ( neg.y < depth ) {
+		depth				= neg.y;
+		penetrationNormal	= XMVectorSet( 0.0f, -1.0f, 0.0f, 0.0f );
+	}
+
+	penetrationDepth = XMVectorReplicate( depth );
+	return true;
+}//IsTouchingBoxes()
+
+bool GameObject::SweepBoxes(
+	const XMFLOAT2 &movingMin,
+	const XMFLOAT2 &movingMax,
+	const XMFLOAT2 &displacement,
+	const XMFLOAT2 &staticMin,
+	const XMFLOAT2 &staticMax,
+	float &time,
+	XMFLOAT2 &normal ) {
+
+	if ( movingMin.x < staticMax.x && staticMin.x < movingMax.x && movingMin.y < staticMax.y && staticMin.y < movingMax.y ) {
+		return false;
+	}
+
+	const float movingLow[2]	= { movingMin.x, movingMin.y };
+	const float movingHigh[2]	= { movingMax.x, movingMax.y };
+	const float staticLow[2]	= { staticMin.x, staticMin.y };
+	const float staticHigh[2]	= { staticMax.x, staticMax.y };
+	const float distance[2]		= { displacement.x, displacement.y };
+
+	//NOTE: Per axis the boxes overlap from entry to exit (in fractions of the displacement),
+	//		they touch where all axes overlap. The axis entered last gives the face hit.
+	float	entry	= 0.0f;
+	float	exit	= 1.0f;
+	int		face	= -1;
+
+	for ( int axis = 0; axis < 2; ++axis ) {
+		if ( distance[axis] == 0.0f ) {
+			if ( movingHigh[axis] <= staticLow[axis] || staticHigh[axis] <= movingLow[axis] ) {
+				return false;
+			}
+
+			continue;
+		}
+
+		float axisEntry, axisExit;
+
+		if ( distance[axis] > 0.0f ) {
+			axisEntry	= ( staticLow[axis] - movingHigh[axis] ) / distance[axis];
+			axisExit	= ( staticHigh[axis] - movingLow[axis] ) / distance[axis];
+		} else {
+			axisEntry	= ( staticHigh[axis] - movingLow[axis] ) / distance[axis];
+			axisExit	= ( staticLow[axis] - movingHigh[axis] ) / distance[axis];
+		}
+
+		if ( axisEntry >= entry ) {
+			entry	= axisEntry;
+			face	= axis;
+		}
+
+		exit = std::min<float>( exit, axisExit );
+	}
+
+	if ( face < 0 || entry >= exit ) {
+		return false;
+	}
+
+	time		= entry;
+	normal.x	= face == 0 ? ( distance[0] > 0.0f ? -1.0f : 1.0f ) : 0.0f;
+	normal.y	= face == 1 ? ( distance[1] > 0.0f ? -1.0f : 1.0f ) : 0.0f;
+	return true;
+}//SweepBoxes()
+
 bool GameObject::IsTouching( const GameObject *other, XMVECTOR &penetrationDepth, XMVECTOR &penetrationNormal ) const {
-	auto simplex	= std::vector<XMFLOAT3>();
+	if ( IsAxisAligned() && other->IsAxisAligned() ) {
+		return IsTouchingAABB( other, penetrationDepth, penetrationNormal );
+	}
+
+	return IsTouchingConvex( other, penetrationDepth, penetrationNormal );
+}//IsTouching()
+
+bool GameObject::IsTouching( const GameObject *other ) const {
+	if ( IsAxisAligned() && other->IsAxisAligned() ) {
+		return IsTouchingAABB( other );
+	}
+
+	return IsTouchingConvex( other );
+}//IsTouching()
+
+bool GameObject::IsTouchingConvex( const GameObject *other, XMVECTOR &penetrationDepth, XMVECTOR &penetrationNormal ) const {
+	Utility::Simplex simplex;
 	auto direction	= XMVectorSubtract( other->GetHitBoxCenter(), GetHitBoxCenter() );
 
 	if ( XMVector2Equal( direction, g_XMZero ) ) {
@@ -204,10 +336,10 @@ bool GameObject::IsTouching( const GameObject *other, XMVECTOR &penetrationDepth
 	}
 
 	return false;
-}//IsTouching()
+}//IsTouchingConvex()
 
-bool GameObject::IsTouching( const GameObject *other ) const {
-	auto simplex	= std::vector<XMFLOAT3>();
+bool GameObject::IsTouchingConvex( const GameObject *other ) const {
+	Utility::Simplex simplex;
 	auto direction	= XMVectorSubtract( other->GetHitBoxCenter(), GetHitBoxCenter() );
 
 	if ( XMVector2Equal( direction, g_XMZero ) ) {
@@ -241,4 +373,4 @@ bool GameObject::IsTouching( const GameObject *other ) const {
 	}
 
 	return false;
-}//IsTouching()
+}//IsTouchingConvex()
@@ -24,6 +24,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "IGameObject.h"
+#include "GJK.h"
 
 namespace BreakIt {
 	namespace Objects {
@@ -35,9 +36,40 @@ namespace BreakIt {
 
 			virtual void Update( float elapsedTime, float totalTime ) override;
 
+			//NOTE: IsTouching() solves box against box in closed form and only falls back to
+			//		GJK/EPA (IsTouchingConvex()) if one of the objects has a non box hitbox.
 			bool IsTouching( const GameObject *other ) const;
 			bool IsTouching( const GameObject *other, DirectX::XMVECTOR &penetrationDepth, DirectX::XMVECTOR &penetrationNormal ) const;
-			DirectX::XMVECTOR GetFarthestPoint( DirectX::FXMVECTOR direction ) const;
+			bool IsTouchingConvex( const GameObject *other ) const;
+			bool IsTouchingConvex( const GameObject *other, DirectX::XMVECTOR &penetrationDepth, DirectX::XMVECTOR &penetrationNormal ) const;
+
+			//NOTE: The closed form box tests behind IsTouching(), for hitboxes that are not kept in a
+			//		GameObject. Depth and normal are those of box a against box b.
+			static bool IsTouchingBoxes( DirectX::FXMVECTOR aMin, DirectX::FXMVECTOR aMax, DirectX::FXMVECTOR bMin, DirectX::GXMVECTOR bMax );
+			static bool IsTouchingBoxes(
+				DirectX::FXMVECTOR aMin,
+				DirectX::FXMVECTOR aMax,
+				DirectX::FXMVECTOR bMin,
+				DirectX::GXMVECTOR bMax,
+				DirectX::XMVECTOR &penetrationDepth,
+				DirectX::XMVECTOR &penetrationNormal
+				);
+
+			//NOTE: Swept box test. Moves the first box by displacement and returns the fraction of it
+			//		covered up to the first contact with the second, and the normal of the face that is hit.
+			//		Boxes already touching at the start are left to IsTouching().
+			static bool SweepBoxes(
+				const DirectX::XMFLOAT2 &movingMin,
+				const DirectX::XMFLOAT2 &movingMax,
+				const DirectX::XMFLOAT2 &displacement,
+				const DirectX::XMFLOAT2 &staticMin,
+				const DirectX::XMFLOAT2 &staticMax,
+				float &time,
+				DirectX::XMFLOAT2 &normal
+				);
+
+			virtual bool				IsAxisAligned() const;
+			virtual DirectX::XMVECTOR	GetFarthestPoint( DirectX::FXMVECTOR direction ) const;
 
 			DirectX::XMVECTOR GetHitBoxCenter() const;
 			DirectX::XMVECTOR GetHitBoxTopLeft() const;
@@ -49,13 +81,16 @@ namespace BreakIt {
 			DirectX::XMFLOAT2 HitBoxSize;
 
 		private:
+			bool IsTouchingAABB( const GameObject *other ) const;
+			bool IsTouchingAABB( const GameObject *other, DirectX::XMVECTOR &penetrationDepth, DirectX::XMVECTOR &penetrationNormal ) const;
+
 			DirectX::XMVECTOR MinkowskiSupport(
 				const GameObject *other, 
 				DirectX::FXMVECTOR direction
 				) const;
 
 			void EPAPenetration(
-				std::vector<DirectX::XMFLOAT3> &simplex, 
+				Utility::Simplex &simplex, 
 				const GameObject *other,
 				DirectX::XMVECTOR &penetrationDepth,
 				DirectX::XMVECTOR &penetrationNormal
@@ -24,17 +24,23 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "pch.h"
 #include "GameplayManager.h"
 #include "Globals.h"
+#include "Random.h"
 
 using namespace WinGame;
 using namespace WinGame::Audio;
-using namespace WinGame::Content;
 using namespace WinGame::Graphics;
+#ifndef BREAKIT_HEADLESS
+using namespace WinGame::Content;
 using namespace WinGame::Game;
+#endif
 using namespace BreakIt;
 using namespace BreakIt::Objects;
 using namespace BreakIt::Styles;
 using namespace DirectX;
 
+const std::uint32_t StateMagic		= 0x53534942; //"BISS"
+const std::uint16_t StateVersion	= 2;
+
 class GameplayManager::Impl {
 public:
 	Impl();
@@ -49,6 +55,28 @@ public:
 
 	int levelNum;
 
+	//Determinism
+	bool			hasSeed;
+	bool			isRecording;
+	bool			recordNextLoad;
+	std::uint32_t	seed;
+	std::uint32_t	tickCount;
+	float			tickTime;
+	float			simulationTime;
+	Replay			replay;
+
+	//Rewind
+	bool						isRewindEnabled;
+	RewindBuffer				rewindBuffer;
+	std::vector<std::uint8_t>	rewindSnapshot;
+	std::vector<std::uint8_t>	stateBackup;
+
+	//Stress mode
+	std::uint32_t stressBalls;
+
+	//Collisions of the current tick
+	CollisionQueue collisions;
+
 	//Resources
 	std::shared_ptr<Texture2D> styleTexture;
 
@@ -57,6 +85,8 @@ public:
 	std::unique_ptr<ItemManager>	itemManager;
 	std::unique_ptr<BrickManager>	brickManager;
 	std::unique_ptr<SoundManager>	soundManager;
+	ISoundObserver					*sounds;
+	Mixer							*mixer;
 	std::unique_ptr<Player>			player;
 
 	RECT pipeRECT;
@@ -64,6 +94,14 @@ public:
 
 	//Methods
 	void ResetPlayer();
+	void PlaySound( SOUND_FILE file );
+	void ProcessCollisions();
+	void MoveObjects( bool widescreen );
+	void InitializeObjects( const std::shared_ptr<Texture2D> &texture );
+	void LoadBricks( const std::uint8_t *pixels, std::uint32_t length );
+#ifndef BREAKIT_HEADLESS
+	Concurrency::task<void> DecodeMap( Windows::Storage::Streams::IRandomAccessStream ^stream );
+#endif
 };//GameplayManager::Impl class
 
 GameplayManager::Impl::Impl() :
@@ -74,10 +112,21 @@ GameplayManager::Impl::Impl() :
 	isGameLost( false ),
 	isGameQuit( false ),
 	isGamePaused( false ),
+	hasSeed( false ),
+	isRecording( false ),
+	recordNextLoad( false ),
+	seed( 0 ),
+	tickCount( 0 ),
+	tickTime( 1.0f / DefaultTickRate ),
+	simulationTime( 0.0f ),
+	isRewindEnabled( false ),
+	stressBalls( 0 ),
 	ballManager( new BallManager() ),
 	itemManager( new ItemManager() ),
 	brickManager( new BrickManager() ),
 	soundManager( new SoundManager() ),
+	sounds( nullptr ),
+	mixer( nullptr ),
 	player( nullptr ) {
 
 	pipeRECT.left	= 0;
@@ -99,8 +148,54 @@ void GameplayManager::Impl::ResetPlayer() {
 	}
 
 	player->Position.x = screenCenterX - player->HitBoxSize.x * 0.5f;
+	player->StorePreviousPosition();
 }//ResetPlayer()
 
+void GameplayManager::Impl::PlaySound( SOUND_FILE file ) {
+	if ( sounds ) {
+		sounds->PlaySound( file );
+	}
+}//PlaySound()
+
+void GameplayManager::Impl::ProcessCollisions() {
+	for ( std::uint32_t i = 0; i < collisions.GetCount(); ++i ) {
+		const auto &collision = collisions.GetEvent( i );
+
+		switch ( collision.Type ) {
+		case COLLISION_EVENT::BRICK_HIT:
+			PlaySound( SOUND_FILE::BRICK_HIT );
+			break;
+		case COLLISION_EVENT::BRICK_BREAK:
+			PlaySound( SOUND_FILE::BRICK_BREAK );
+			player->Points += collision.Value;
+			itemManager->AddItem( collision.Position.x, collision.Position.y );
+			break;
+		case COLLISION_EVENT::SIDE_HIT:
+			PlaySound( SOUND_FILE::SIDE_HIT );
+			break;
+		case COLLISION_EVENT::PLAYER_HIT:
+			PlaySound( SOUND_FILE::PLAYER_HIT );
+			break;
+		case COLLISION_EVENT::BALL_LOST:
+			PlaySound( SOUND_FILE::BALL_LOST );
+			//player->Points -= static_cast<std::uint32_t>(static_cast<double>(player->Points) * 0.1);
+
+			if ( player->Points > 5 ) {
+				player->Points -= 5;
+			} else {
+				player->Points = 0;
+			}
+
+			if ( player->Health != 0 && collision.Value != 0 ) {
+				player->Health--;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}//ProcessCollisions()
+
 GameplayManager::GameplayManager() :
 	pImpl( new Impl() ) {
 }//Ctor()
@@ -154,6 +249,10 @@ SoundManager* GameplayManager::GetSounds() const {
 	return pImpl->soundManager.get();
 }//GetSounds()
 
+void GameplayManager::SetSoundObserver( ISoundObserver *observer ) {
+	pImpl->sounds = observer;
+}//SetSoundObserver()
+
 int GameplayManager::GetLevelIndex() const {
 	return pImpl->levelNum;
 }//GetLevelIndex()
@@ -162,6 +261,102 @@ void GameplayManager::SetLevelIndex( int index ) {
 	pImpl->levelNum = index;
 }//SetLevelIndex()
 
+void GameplayManager::Impl::InitializeObjects( const std::shared_ptr<Texture2D> &texture ) {
+	float screenCenterX = GameFieldWidth * 0.5f + SplitterWidth;
+
+	if ( isWidescreen ) {
+		screenCenterX += SidebarWidth;
+	}
+
+	//Init Game Objects
+	ballManager->Initialize( texture, isWidescreen );
+	brickManager->Initialize( texture, isWidescreen );
+	itemManager->Initialize( texture, isWidescreen );
+
+	if ( player ) {
+		player = nullptr;
+	}
+
+	player = std::make_unique<Player>(
+		0.0f,
+		GameFieldHeight - PlayerTextureHeight - 42.0f,
+		texture
+		);
+
+	player->Position.x	= screenCenterX - player->HitBoxSize.x * 0.5f;
+	player->Health		= PlayerStartHealth;
+	player->Points		= 0;
+	player->TempPoints	= 0;
+	player->TempHealth	= PlayerStartHealth;
+
+	//Set Default States
+	isLoaded		= false;
+	isInitialized	= true;
+	isGameLost		= false;
+	isGameWon		= false;
+	isGameQuit		= false;
+	isGamePaused	= false;
+}//InitializeObjects()
+
+void GameplayManager::Impl::LoadBricks( const std::uint8_t *pixels, std::uint32_t length ) {
+#if _DEBUG
+	Utility::BasicTimer buildTimer;
+#endif
+
+	//NOTE: Every pixel is one cell of the BricksWide x BricksHeigh brick field
+	brickManager->AddBricks( pixels, length );
+
+#if _DEBUG
+	buildTimer.Update();
+	Utility::WriteDebugMessage( L"Bricks built in %f ms\n", buildTimer.GetTotalTime() * 1000.0f );
+#endif
+
+	ResetPlayer();
+	player->ResetGrowth();
+	player->ResetLaser();
+	player->TempPoints = player->Points;
+	player->TempHealth = player->Health;
+	ballManager->AddBall();
+
+	if ( stressBalls > 0 ) {
+		ballManager->AddStressBalls( stressBalls );
+	}
+
+	//NOTE: Without a seed of its own every level still starts the item drops from a fresh
+	//		seed, which is what a recording stores. Drawing on from the last level would
+	//		leave the recording with a seed the drops no longer start from.
+	itemManager->SetSeed( hasSeed ? seed : Random::GetClockSeed() );
+	itemManager->ResetCollectedCount();
+
+	if ( recordNextLoad ) {
+		isRecording		= true;
+		recordNextLoad	= false;
+	}
+
+	if ( isRecording ) {
+		replay.Reset( itemManager->GetSeed(), tickTime, isWidescreen );
+	}
+
+	rewindBuffer.Clear();
+	collisions.Reset();
+
+	tickCount		= 0;
+	simulationTime	= 0.0f;
+	isGamePaused	= true;
+	isLoaded		= true;
+}//LoadBricks()
+
+#ifndef BREAKIT_HEADLESS
+Concurrency::task<void> GameplayManager::Impl::DecodeMap( Windows::Storage::Streams::IRandomAccessStream ^stream ) {
+	return create_task( Windows::Graphics::Imaging::BitmapDecoder::CreateAsync( Windows::Graphics::Imaging::BitmapDecoder::BmpDecoderId, stream ) ).then( [this]( Windows::Graphics::Imaging::BitmapDecoder ^decoder ) {
+		return decoder->GetPixelDataAsync();
+
+	} ).then( [this]( Windows::Graphics::Imaging::PixelDataProvider ^pixelProvider ) {
+		auto data = pixelProvider->DetachPixelData();
+		LoadBricks( data->Data, data->Length );
+	} );
+}//DecodeMap()
+
 void GameplayManager::Initialize( GameManager *manager ) {
 	if ( pImpl->isInitialized ) {
 		return;
@@ -171,47 +366,40 @@ void GameplayManager::Initialize( GameManager *manager ) {
 	auto graphics	= manager->GetGraphicsManager();
 	auto style		= manager->GetStyleManager();
 
-	float screenCenterX = GameFieldWidth * 0.5f + SplitterWidth;
-	
-	if ( graphics->GetAspectRatio() <= 1.34f ) {
-		pImpl->isWidescreen = false;
-	} else {
-		pImpl->isWidescreen = true;
-		screenCenterX += SidebarWidth;
-	}
+	pImpl->isWidescreen = graphics->GetAspectRatio() > 1.34f;
 
 	//Set Textures
 	pImpl->styleTexture = content->LoadTexture2D( graphics, style->GetStyleTexture() );
-	
-	//Init Game Objects
-	pImpl->ballManager->Initialize( pImpl->styleTexture, pImpl->isWidescreen );
-	pImpl->brickManager->Initialize( pImpl->styleTexture, pImpl->isWidescreen );
-	pImpl->itemManager->Initialize( pImpl->styleTexture, pImpl->isWidescreen );
 	pImpl->soundManager->Initialize( manager );
+	pImpl->sounds = pImpl->soundManager.get();
+	pImpl->InitializeObjects( pImpl->styleTexture );
+}//Initialize()
+#endif
 
-	if ( pImpl->player ) {
-		pImpl->player = nullptr;
+//NOTE: Headless initialization for running the simulation without a window, graphics device
+//		or audio device. Nothing is drawn and the game is silent until SetSoundObserver().
+void GameplayManager::Initialize( bool widescreen ) {
+	if ( pImpl->isInitialized ) {
+		return;
 	}
 
-	pImpl->player = std::make_unique<Player>(
-		0.0f,
-		GameFieldHeight - PlayerTextureHeight - 42.0f,
-		pImpl->styleTexture
-		);
+	pImpl->isWidescreen = widescreen;
+	pImpl->sounds		= nullptr;
+	pImpl->styleTexture = nullptr;
+	pImpl->InitializeObjects( pImpl->styleTexture );
+}//Initialize()
 
-	pImpl->player->Position.x	= screenCenterX - pImpl->player->HitBoxSize.x * 0.5f;
-	pImpl->player->Health		= PlayerStartHealth;
-	pImpl->player->Points		= 0;
-	pImpl->player->TempPoints	= 0;
-	pImpl->player->TempHealth	= PlayerStartHealth;
+//NOTE: Headless with sound, the style sounds are read from the .wav files under root and
+//		every tick mixes tickTime worth of audio into the mixer's output.
+void GameplayManager::Initialize( bool widescreen, Mixer *mixer, const IStyle *style, const std::string &root ) {
+	if ( pImpl->isInitialized ) {
+		return;
+	}
 
-	//Set Default States
-	pImpl->isLoaded			= false;
-	pImpl->isInitialized	= true;
-	pImpl->isGameLost		= false;
-	pImpl->isGameWon		= false;
-	pImpl->isGameQuit		= false;
-	pImpl->isGamePaused		= false;
+	Initialize( widescreen );
+	pImpl->mixer	= mixer;
+	pImpl->sounds	= pImpl->soundManager.get();
+	pImpl->soundManager->Initialize( mixer, style, root );
 }//Initialize()
 
 void GameplayManager::UnInitialize() {
@@ -224,33 +412,71 @@ void GameplayManager::Resize( bool widescreen ) {
 		return;
 	}
 
-	pImpl->isGamePaused = true;
-	if ( pImpl->isWidescreen != widescreen ) {
-		pImpl->ballManager->Resize( widescreen );
-		pImpl->brickManager->Resize( widescreen );
-		pImpl->itemManager->Resize( widescreen );
+	SetPause( true );
+	pImpl->MoveObjects( widescreen );
+}//Resize()
 
-		if ( pImpl->isWidescreen && !widescreen ) {
-			pImpl->player->Position.x -= SidebarWidth;
-		} else if ( !pImpl->isWidescreen && widescreen ) {
-			pImpl->player->Position.x += SidebarWidth;
+//NOTE: Moves everything into the other screen layout without pausing, restoring a
+//		snapshot switches layouts and must not show up as a pause in the replay.
+void GameplayManager::Impl::MoveObjects( bool widescreen ) {
+	if ( isWidescreen != widescreen ) {
+		ballManager->Resize( widescreen );
+		brickManager->Resize( widescreen );
+		itemManager->Resize( widescreen );
+
+		if ( isWidescreen && !widescreen ) {
+			player->Position.x -= SidebarWidth;
+		} else if ( !isWidescreen && widescreen ) {
+			player->Position.x += SidebarWidth;
 		}
 
-		pImpl->isWidescreen = widescreen;
+		player->StorePreviousPosition();
+
+		isWidescreen = widescreen;
 	}
-}//Resize()
+}//MoveObjects()
 
 void GameplayManager::QuitGame() {
+	if ( pImpl->isRecording ) {
+		pImpl->replay.AddEvent( REPLAY_EVENT::QUIT );
+	}
+
 	pImpl->isGameQuit = true;
 }//QuitGame()
 
 void GameplayManager::Update( FXMVECTOR playerDelta, float elapsedTime, float totalTime ) {
-	if ( !pImpl->isInitialized || !pImpl->isLoaded || pImpl->isGameQuit ) {
+	if ( !pImpl->isInitialized || !pImpl->isLoaded ) {
 		return;
 	}
 
+	if ( pImpl->isRecording ) {
+		pImpl->replay.AddTick( XMVectorGetX( playerDelta ) );
+	}
+
+	if ( pImpl->isGameQuit ) {
+		return;
+	}
+
+	//NOTE: Objects only ever see time counted in ticks since Load(), never wall clock time
+	++pImpl->tickCount;
+	pImpl->simulationTime += elapsedTime;
+	totalTime = pImpl->simulationTime;
+
+	//NOTE: Sounds flushed by the last tick are mixed now, one tick late like a device buffer.
+	//		Paused ticks are mixed as well, so the audio keeps running in step with the ticks.
+	if ( pImpl->mixer ) {
+		pImpl->mixer->Advance( elapsedTime );
+	}
+
 	auto items	= pImpl->itemManager.get();
 	auto bricks = pImpl->brickManager.get();
+	auto player = pImpl->player.get();
+	auto balls	= pImpl->ballManager.get();
+
+	//Remember last Tick for Interpolation
+	player->StorePreviousPositions();
+	balls->StorePreviousPositions();
+	items->StorePreviousPositions();
 
 	//Animate Stuff
 	items->Animate( elapsedTime );
@@ -261,23 +487,26 @@ void GameplayManager::Update( FXMVECTOR playerDelta, float elapsedTime, float to
 	}
 
 	//Update Stuff
-	auto sounds = pImpl->soundManager.get();
-	auto player = pImpl->player.get();
-	auto balls	= pImpl->ballManager.get();
+	auto sounds = pImpl->sounds;
+
+	pImpl->collisions.Clear();
 
-	player->Update( elapsedTime, totalTime, sounds, bricks, items );
+	player->Update( elapsedTime, totalTime, sounds, bricks, &pImpl->collisions );
 	player->Move( playerDelta );
-	balls->Update( player, sounds, elapsedTime, totalTime );
-	balls->CheckCollision( player, bricks, items, sounds );
+	balls->Update( player, bricks, sounds, &pImpl->collisions, elapsedTime, totalTime );
+
+	//NOTE: Sounds, points and item drops of the collisions are applied only now, in the
+	//		order they happened, so items dropped this tick still fall this tick.
+	pImpl->ProcessCollisions();
 	items->Update( player, balls, sounds, elapsedTime, totalTime );
 
 	//Set new States
 	if ( player->Health == 0 ) {
-		sounds->PlaySound( SOUND_FILE::GAME_LOST );
+		pImpl->PlaySound( SOUND_FILE::GAME_LOST );
 		pImpl->isGameLost = true;
 	} else {
 		if ( bricks->GetCount() == 0 ) {
-			sounds->PlaySound( SOUND_FILE::GAME_WON );
+			pImpl->PlaySound( SOUND_FILE::GAME_WON );
 			items->GiveAll( player, balls );
 			pImpl->isGameWon = true;
 		} else if ( balls->GetCount() == 0 ) {
@@ -287,14 +516,26 @@ void GameplayManager::Update( FXMVECTOR playerDelta, float elapsedTime, float to
 			pImpl->isGamePaused = true;
 		}
 	}
+
+	if ( sounds ) {
+		sounds->Flush();
+	}
+
+	if ( pImpl->isRewindEnabled ) {
+		SaveState( pImpl->rewindSnapshot );
+		pImpl->rewindBuffer.Push( pImpl->tickCount, pImpl->rewindSnapshot );
+	}
 }//Update()
 
-void GameplayManager::Draw( SpriteBatch *batch ) {
+#ifndef BREAKIT_HEADLESS
+void GameplayManager::Draw( SpriteBatch *batch, float interpolation ) {
 	if ( !pImpl->isInitialized ) {
 		return;
 	}
 
-	if ( pImpl->isLoaded ) {
+	DrawableObject::SetRenderInterpolation( interpolation );
+
+	if ( pImpl->isLoaded && pImpl->styleTexture ) {
 		pImpl->brickManager->Draw( batch );
 
 		RECT dest;
@@ -328,8 +569,13 @@ void GameplayManager::Draw( SpriteBatch *batch ) {
 		pImpl->itemManager->Draw( batch );
 	}
 }//Draw()
+#endif
 
 void GameplayManager::SetPause( bool pause ) {
+	if ( pImpl->isRecording && pImpl->isGamePaused != pause ) {
+		pImpl->replay.AddEvent( pause ? REPLAY_EVENT::PAUSE : REPLAY_EVENT::RESUME );
+	}
+
 	pImpl->isGamePaused = pause;
 }//Pause()
 
@@ -351,6 +597,7 @@ void GameplayManager::Unload() {
 	}
 }//Unload()
 
+#ifndef BREAKIT_HEADLESS
 void GameplayManager::Load( const wchar_t *filename ) {
 	if ( !pImpl->isInitialized ) {
 		return;
@@ -367,56 +614,230 @@ void GameplayManager::Load( const wchar_t *filename ) {
 		return file->OpenReadAsync();
 
 	} ).then( [this]( Windows::Storage::Streams::IRandomAccessStreamWithContentType ^stream ) {
-		return Windows::Graphics::Imaging::BitmapDecoder::CreateAsync( Windows::Graphics::Imaging::BitmapDecoder::BmpDecoderId, stream );
+		return pImpl->DecodeMap( stream );
+	} );
+}//Load()
 
-	} ).then( [this]( Windows::Graphics::Imaging::BitmapDecoder ^decoder ) {
-		return decoder->GetPixelDataAsync();
+void GameplayManager::LoadBitmap( const std::uint8_t *data, std::uint32_t length ) {
+	if ( !pImpl->isInitialized ) {
+		return;
+	}
 
-	} ).then( [this]( Windows::Graphics::Imaging::PixelDataProvider ^pixelProvider ) {
-		auto data = pixelProvider->DetachPixelData();
+	if ( pImpl->isLoaded ) {
+		Unload();
+	}
 
-		float texOffset		= ( ItemTextureWidth - ItemWidth ) * 0.5f;
-		float startPosX		= 0.0f;
-		float startPosY		= -texOffset;
-		float baseStartX	= 0.0f;
+	//NOTE: This copies the file into a stream, BitmapDecoder only reads from WinRT streams.
+	//		A map is a 30x20 .bmp of a few kB, so the copy costs less than wrapping the mapping
+	//		in a stream of its own would. data does not have to outlive the call.
+	auto stream = ref new Windows::Storage::Streams::InMemoryRandomAccessStream();
+	auto writer = ref new Windows::Storage::Streams::DataWriter( stream );
 
-		std::uint8_t CountX = 0;
-		std::uint8_t CountY = 0;
+	writer->WriteBytes( Platform::ArrayReference<std::uint8_t>( const_cast<std::uint8_t*>( data ), length ) );
 
-		if ( !pImpl->isWidescreen ) {
-			baseStartX = SplitterWidth - texOffset;
-		} else {
-			baseStartX = SplitterWidth + SidebarWidth - texOffset;
-		}
+	create_task( writer->StoreAsync() ).then( [this, stream, writer]( unsigned int ) {
+		writer->DetachStream();
+		stream->Seek( 0 );
+		return pImpl->DecodeMap( stream );
+	} );
+}//LoadBitmap()
+#endif
 
-		startPosX = baseStartX;
-		for ( decltype( data->Length ) i = 0; i < data->Length; i += 4 ) {
-			pImpl->brickManager->AddBrick( startPosX, startPosY, data[i], data[i+1], data[i+2] );
+void GameplayManager::Load( const std::uint8_t *pixels, std::uint32_t length ) {
+	if ( !pImpl->isInitialized ) {
+		return;
+	}
 
-			++CountX;
-			startPosX += ItemWidth;
+	if ( pImpl->isLoaded ) {
+		Unload();
+	}
 
-			if ( CountX >= BricksWide ) {
-				CountX = 0;
-				++CountY;
-				
-				startPosX = baseStartX;
-				startPosY += ItemHeight;
+	pImpl->LoadBricks( pixels, length );
+}//Load()
 
-				if ( CountY >= BricksHeigh ) {
-					break;
-				}
-			}
-		}
+void GameplayManager::SaveState( std::vector<std::uint8_t> &data ) const {
+	data.clear();
 
-		pImpl->ResetPlayer();
-		pImpl->player->ResetGrowth();
-		pImpl->player->ResetLaser();
-		pImpl->player->TempPoints = pImpl->player->Points;
-		pImpl->player->TempHealth = pImpl->player->Health;
-		pImpl->ballManager->AddBall();
+	if ( !pImpl->isInitialized || !pImpl->isLoaded ) {
+		return;
+	}
 
-		pImpl->isGamePaused = true;
-		pImpl->isLoaded = true;
-	} );
-}//Load()
+	SnapshotWriter writer( data );
+	writer.Write( StateMagic );
+	writer.Write( StateVersion );
+	writer.Write( pImpl->isWidescreen );
+	writer.Write( pImpl->isGameWon );
+	writer.Write( pImpl->isGameLost );
+	writer.Write( pImpl->isGameQuit );
+	writer.Write( pImpl->isGamePaused );
+	writer.Write( pImpl->levelNum );
+	writer.Write( pImpl->tickCount );
+	writer.Write( pImpl->simulationTime );
+
+	pImpl->player->SaveState( writer );
+	pImpl->brickManager->SaveState( writer );
+	pImpl->ballManager->SaveState( writer );
+	pImpl->itemManager->SaveState( writer );
+}//SaveState()
+
+bool GameplayManager::LoadState( const std::uint8_t *data, std::uint32_t length ) {
+	if ( !pImpl->isInitialized ) {
+		return false;
+	}
+
+	//NOTE: Reading replaces the level piece by piece, so the current one is saved first and
+	//		put back when the snapshot turns out to be truncated or out of range halfway in.
+	auto backup = &pImpl->stateBackup;
+	SaveState( *backup );
+
+	if ( ReadState( data, length ) ) {
+		return true;
+	}
+
+	if ( !pImpl->isLoaded && !backup->empty() ) {
+		ReadState( backup->data(), static_cast<std::uint32_t>( backup->size() ) );
+	}
+
+	return false;
+}//LoadState()
+
+bool GameplayManager::ReadState( const std::uint8_t *data, std::uint32_t length ) {
+	SnapshotReader reader( data, length );
+	std::uint32_t	magic		= 0;
+	std::uint16_t	version		= 0;
+	bool			widescreen	= false;
+
+	reader.Read( magic );
+	reader.Read( version );
+	reader.Read( widescreen );
+
+	if ( !reader.IsValid() || magic != StateMagic || version != StateVersion ) {
+		return false;
+	}
+
+	//NOTE: Positions are stored in the layout they were saved in, so the level is
+	//		restored in that layout and moved into the current one afterwards.
+	bool currentWidescreen = pImpl->isWidescreen;
+	Unload();
+	pImpl->MoveObjects( widescreen );
+
+	reader.Read( pImpl->isGameWon );
+	reader.Read( pImpl->isGameLost );
+	reader.Read( pImpl->isGameQuit );
+	reader.Read( pImpl->isGamePaused );
+	reader.Read( pImpl->levelNum );
+	reader.Read( pImpl->tickCount );
+	reader.Read( pImpl->simulationTime );
+
+	pImpl->player->LoadState( reader );
+	pImpl->brickManager->LoadState( reader );
+	pImpl->ballManager->LoadState( reader );
+	pImpl->itemManager->LoadState( reader );
+
+	if ( !reader.IsValid() ) {
+		Unload();
+		pImpl->MoveObjects( currentWidescreen );
+		return false;
+	}
+
+	pImpl->MoveObjects( currentWidescreen );
+	pImpl->isLoaded = true;
+
+	return true;
+}//ReadState()
+
+void GameplayManager::EnableRewind( std::uint32_t memoryBudget, std::uint32_t keyframeInterval ) {
+	pImpl->isRewindEnabled = true;
+	pImpl->rewindBuffer.Reset( memoryBudget, keyframeInterval );
+}//EnableRewind()
+
+void GameplayManager::DisableRewind() {
+	pImpl->isRewindEnabled = false;
+	pImpl->rewindBuffer.Clear();
+}//DisableRewind()
+
+bool GameplayManager::RewindTo( std::uint32_t tick ) {
+#if _DEBUG
+	Utility::BasicTimer rewindTimer;
+#endif
+
+	if ( !pImpl->isRewindEnabled || !pImpl->rewindBuffer.Restore( tick, pImpl->rewindSnapshot ) ) {
+		return false;
+	}
+
+	if ( !LoadState( pImpl->rewindSnapshot.data(), static_cast<std::uint32_t>( pImpl->rewindSnapshot.size() ) ) ) {
+		pImpl->rewindBuffer.Clear();
+		return false;
+	}
+
+#if _DEBUG
+	rewindTimer.Update();
+
+	auto buffer		= &pImpl->rewindBuffer;
+	float tickTime	= pImpl->tickCount > 0 ? pImpl->simulationTime / static_cast<float>( pImpl->tickCount ) : 0.0f;
+	float history	= static_cast<float>( buffer->GetLastTick() - buffer->GetFirstTick() + 1 ) * tickTime;
+
+	Utility::WriteDebugMessage(
+		L"Rewound to tick %u in %f ms, %f s of history in %u bytes (%f kB/s)\n",
+		pImpl->tickCount,
+		rewindTimer.GetTotalTime() * 1000.0f,
+		history,
+		buffer->GetMemoryUsage(),
+		history > 0.0f ? static_cast<float>( buffer->GetMemoryUsage() ) / 1024.0f / history : 0.0f
+		);
+#endif
+
+	return true;
+}//RewindTo()
+
+const RewindBuffer* GameplayManager::GetRewindBuffer() const {
+	return &pImpl->rewindBuffer;
+}//GetRewindBuffer()
+
+void GameplayManager::SetStressBalls( std::uint32_t count ) {
+	pImpl->stressBalls = count;
+}//SetStressBalls()
+
+std::uint32_t GameplayManager::GetStressBalls() const {
+	return pImpl->stressBalls;
+}//GetStressBalls()
+
+const CollisionQueue* GameplayManager::GetCollisions() const {
+	return &pImpl->collisions;
+}//GetCollisions()
+
+void GameplayManager::SetSeed( std::uint32_t seed ) {
+	pImpl->hasSeed	= true;
+	pImpl->seed		= seed;
+}//SetSeed()
+
+void GameplayManager::ClearSeed() {
+	pImpl->hasSeed = false;
+}//ClearSeed()
+
+std::uint32_t GameplayManager::GetSeed() const {
+	return pImpl->hasSeed ? pImpl->seed : pImpl->itemManager->GetSeed();
+}//GetSeed()
+
+//NOTE: The seed of a level is only known once it is loaded, so the replay is started there
+void GameplayManager::StartRecording( float tickTime ) {
+	pImpl->recordNextLoad	= true;
+	pImpl->tickTime			= tickTime;
+}//StartRecording()
+
+void GameplayManager::StopRecording() {
+	pImpl->isRecording		= false;
+	pImpl->recordNextLoad	= false;
+}//StopRecording()
+
+bool GameplayManager::IsRecording() const {
+	return pImpl->isRecording || pImpl->recordNextLoad;
+}//IsRecording()
+
+const Replay* GameplayManager::GetReplay() const {
+	return &pImpl->replay;
+}//GetReplay()
+
+std::uint32_t GameplayManager::GetTickCount() const {
+	return pImpl->tickCount;
+}//GetTickCount()
@@ -23,12 +23,18 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+#ifndef BREAKIT_HEADLESS
 #include "GameManager.h"
+#endif
+
 #include "BallManager.h"
 #include "BrickManager.h"
 #include "ItemManager.h"
 #include "Player.h"
 #include "SoundManager.h"
+#include "Replay.h"
+#include "RewindBuffer.h"
+#include "CollisionQueue.h"
 
 namespace BreakIt {
 	namespace Objects {
@@ -53,18 +59,69 @@ namespace BreakIt {
 			SoundManager*	GetSounds() const;
 
 			void QuitGame();
+#ifndef BREAKIT_HEADLESS
 			void Initialize( WinGame::Game::GameManager *manager );
+#endif
+			void Initialize( bool widescreen );
+			void Initialize( bool widescreen, WinGame::Audio::Mixer *mixer, const Styles::IStyle *style, const std::string &root );
 			void UnInitialize();
 			void Resize( bool widescreen );
 			void Update( DirectX::FXMVECTOR playerDelta, float elapsedTime, float totalTime );
-			void Draw( DirectX::SpriteBatch *batch );
+#ifndef BREAKIT_HEADLESS
+			void Draw( DirectX::SpriteBatch *batch, float interpolation = 1.0f );
+#endif
 			void SetPause( bool pause );
 			void SetLevelIndex( int index );
 
 			void Unload();
+			void Load( const std::uint8_t *pixels, std::uint32_t length );
+#ifndef BREAKIT_HEADLESS
 			void Load( const wchar_t *filename );
+			//A map .bmp file already in memory, e.g. from an asset pack. The bytes are copied.
+			void LoadBitmap( const std::uint8_t *data, std::uint32_t length );
+#endif
+
+			//NOTE: Every sound the game makes goes to the observer, nullptr runs the game silent.
+			//		The Initialize() variants with sound attach GetSounds().
+			void SetSoundObserver( ISoundObserver *observer );
+
+			//NOTE: A snapshot holds the complete state of the loaded level. Restoring needs an
+			//		initialized manager but no Load(), the level comes back exactly as it was saved.
+			void SaveState( std::vector<std::uint8_t> &data ) const;
+			bool LoadState( const std::uint8_t *data, std::uint32_t length );
+
+			//NOTE: While rewind is enabled every simulated tick is kept in a RewindBuffer.
+			//		RewindTo() goes back to the latest retained tick at or before the given one.
+			//		HeadlessRunner -rewind measures the cost per tick, memory and restore time.
+			void				EnableRewind( std::uint32_t memoryBudget = RewindMemoryBudget, std::uint32_t keyframeInterval = RewindKeyframeInterval );
+			void				DisableRewind();
+			bool				RewindTo( std::uint32_t tick );
+			const RewindBuffer*	GetRewindBuffer() const;
+
+			//NOTE: Every Load() adds this many extra balls on top of the level, 0 turns stress mode off.
+			void			SetStressBalls( std::uint32_t count = StressBallCount );
+			std::uint32_t	GetStressBalls() const;
+
+			//NOTE: Collisions of the last simulated tick and totals since Load(), for tests and telemetry.
+			const CollisionQueue* GetCollisions() const;
+
+			//NOTE: With a seed set every Load() restarts the item drops from that seed, so a level
+			//		played with the same ticks and input always ends the same way. Without one
+			//		every Load() draws a new seed, GetSeed() and the recording report it.
+			void			SetSeed( std::uint32_t seed );
+			void			ClearSeed();
+			std::uint32_t	GetSeed() const;
+
+			//NOTE: Recording starts with the next Load() and stores one entry per Update() call.
+			void			StartRecording( float tickTime );
+			void			StopRecording();
+			bool			IsRecording() const;
+			const Replay*	GetReplay() const;
+			std::uint32_t	GetTickCount() const;
 
 		private:
+			bool ReadState( const std::uint8_t *data, std::uint32_t length );
+
 			UTILITY_CLASS_COPY( GameplayManager );
 			UTILITY_CLASS_PIMPL();
 
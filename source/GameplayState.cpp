@@ -160,6 +160,9 @@ public:
 	//Music
 	std::shared_ptr<Music> titleMusic;
 
+	//Input gathered since the last Tick
+	XMFLOAT2 playerDelta;
+
 	//Methods
 	XMVECTOR GetPlayerDelta( InputManager *input );
 
@@ -177,6 +180,7 @@ public:
 };//GameplayState::Impl class
 
 GameplayState::Impl::Impl() :
+	playerDelta( 0.0f, 0.0f ),
 	edgeEvent( ref new EdgeEvent() ),
 	isAdded( false ),
 	isButtonHit( false ) {
@@ -390,7 +394,6 @@ void GameplayState::Update( float elapsedTime, float totalTime ) {
 	auto level	= gameManager->GetGameplayManager();
 	auto vr		= gameManager->GetVirtualResolution();
 	
-	pImpl->titleMusic->Update();
 	pImpl->objLogo->Update( elapsedTime, totalTime );
 	pImpl->guiManager->Update( gameManager );
 
@@ -447,9 +450,21 @@ void GameplayState::Update( float elapsedTime, float totalTime ) {
 		}
 	}
 
-	level->Update( pImpl->GetPlayerDelta( input ), elapsedTime, totalTime );
+	XMStoreFloat2(
+		&pImpl->playerDelta,
+		XMVectorAdd( XMLoadFloat2( &pImpl->playerDelta ), pImpl->GetPlayerDelta( input ) )
+		);
 }//Update()
 
+void GameplayState::FixedUpdate( float tickTime, float totalTime ) {
+	auto level = gameManager->GetGameplayManager();
+
+	//NOTE: The paddle follows the pointer, so all movement since the last tick is applied
+	//		at once instead of being spread over the ticks of this frame.
+	level->Update( XMLoadFloat2( &pImpl->playerDelta ), tickTime, totalTime );
+	pImpl->playerDelta = XMFLOAT2( 0.0f, 0.0f );
+}//FixedUpdate()
+
 void GameplayState::Draw( float elapsedTime, float totalTime ) {
 	auto sprites = gameManager->GetSpriteBatch();
 	auto graphics = gameManager->GetGraphicsManager();
@@ -486,7 +501,7 @@ void GameplayState::Draw( float elapsedTime, float totalTime ) {
 		);
 
 	//Draw Gameplay
-	level->Draw( sprites );
+	level->Draw( sprites, gameManager->GetInterpolation() );
 
 	//Draw GUI
 	gui->Draw( sprites, true );
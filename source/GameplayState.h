@@ -39,6 +39,7 @@ namespace BreakIt {
 			virtual void Resume() override;
 			virtual void Update( float elapsedTime, float totalTime ) override;
 			virtual void Draw( float elapsedTime, float totalTime ) override;
+			virtual void FixedUpdate( float tickTime, float totalTime ) override;
 
 		private:
 			UTILITY_CLASS_COPY( GameplayState );
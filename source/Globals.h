@@ -41,6 +41,30 @@ namespace BreakIt
 	const std::int8_t BricksWide	= 30;
 	const std::int8_t BricksHeigh	= 20;
 
+	//Simulation Vars
+	//Gameplay runs in ticks of a fixed length. A frame never runs more than
+	//MaximumTicksPerFrame ticks, any time left over beyond that is dropped.
+	const float			DefaultTickRate			= 60.0f;
+	const float			MinimumTickRate			= 10.0f;
+	const std::uint32_t	MaximumTicksPerFrame	= 5;
+
+	//Rewind history, a full snapshot every RewindKeyframeInterval ticks
+	const std::uint32_t	RewindMemoryBudget		= 4 * 1024 * 1024;
+	const std::uint32_t	RewindKeyframeInterval	= 60;
+
+	//Batch simulation, a game is given up after BatchMaximumTicks
+	const std::uint32_t	BatchMaximumTicks		= 60 * 60 * 10;
+	const float			AutopilotPaddleSpeed	= 900.0f;
+
+	//Stress mode, balls added on top of a level and how many updates one debug report spans
+	const std::uint32_t	StressBallCount			= 4096;
+	const std::uint32_t	StressReportInterval	= 600;
+
+	//Objects kept ready in the spawn pools when a level starts, items are counted per type
+	const std::uint32_t	BallPoolSize	= 32;
+	const std::uint32_t	ItemPoolSize	= 8;
+	const std::uint32_t	LaserPoolSize	= 32;
+
 	//Ball Vars
 	const float BallWidth			= 20.0f;
 	const float BallHeight			= 20.0f;
@@ -48,6 +72,15 @@ namespace BreakIt
 	const float BallTextureHeight	= 32.0f; 
 	const float MinimumBallSpeed	= 220.0f;
 
+	//Balls never move further than this in one collision step, which keeps them
+	//from passing through bricks, the paddle or the steel wall on long frames.
+	const float			MaximumBallStep		= BallHeight * 0.5f;
+	const std::uint32_t	MaximumBallSubSteps	= 128;
+
+	//Once the step cap is hit a ball is swept to the first thing in its way instead and
+	//stopped this far inside it, so the collision step still sees the contact.
+	const float			SweepContactDepth	= 1.0f;
+
 	//Player Vars
 	const float PlayerTextureWidth	= 32.0f;
 	const float PlayerTextureHeight = 40.0f;
@@ -84,10 +117,32 @@ namespace BreakIt
 		PADDLE_SHRINK
 	};//ITEM_TYPES enum class
 
+	//Per type item data is kept in arrays indexed by ITEM_TYPES
+	const std::uint32_t ItemTypeCount = static_cast<std::uint32_t>( ITEM_TYPES::PADDLE_SHRINK ) + 1;
+
+	//How likely an item drops relative to the others, indexed by ITEM_TYPES.
+	//tools/DropTest checks the drops against this table.
+	const double ItemDropWeights[ItemTypeCount] = {
+		400.0,	//COIN
+		2.0,	//HEART
+		0.05,	//DIAMOND
+		0.09,	//FIRST_AID
+		7.0,	//DEATH_BALL
+		8.0,	//EXTRA_BALL
+		6.0,	//STEEL_WALL
+		10.0,	//LASER_GUN
+		0.9,	//INVISIBLE_BALL
+		11.0,	//SOFT_BALL
+		12.0,	//PADDLE_ENLARGE
+		11.5	//PADDLE_SHRINK
+	};
+
 	//Resource vars
-	const std::wstring MusicFilename	= L"Assets\\Music\\Psykick_Roya_loop_mix_.wma";
-	const std::wstring TextureFilename	= L"Assets\\Textures\\gui.dds";
-	const std::wstring FontFilename		= L"Assets\\Fonts\\segoeUIsemi20.spritefont";
-	const std::wstring FontFilename2	= L"Assets\\Fonts\\TinyBoxBlackBitA8.spritefont";
+	const std::wstring AssetPackFilename	= L"Assets.pack";
+	const std::wstring MusicFilename		= L"Assets\\Music\\Psykick_Roya_loop_mix_.wma";
+	const std::wstring SoundBankFilename	= L"Assets\\Sounds\\Sounds.bank";
+	const std::wstring TextureFilename		= L"Assets\\Textures\\gui.dds";
+	const std::wstring FontFilename			= L"Assets\\Fonts\\segoeUIsemi20.spritefont";
+	const std::wstring FontFilename2		= L"Assets\\Fonts\\TinyBoxBlackBitA8.spritefont";
 
 }//BreakIt namespace
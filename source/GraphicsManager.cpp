@@ -64,6 +64,9 @@ public:
 
 	Concurrency::task<void> CreateTexture2DAsync(
 		const wchar_t *filename, 
+		const byte *data,
+		std::size_t size,
+		std::shared_ptr<const void> owner,
 		std::shared_ptr<Texture2D> &texture
 		) const;
 
@@ -284,11 +287,18 @@ void GraphicsManager::Impl::CreateWindowSizeDependentResources() {
 
 Concurrency::task<void> GraphicsManager::Impl::CreateTexture2DAsync(
 	const wchar_t *filename, 
+	const byte *data,
+	std::size_t size,
+	std::shared_ptr<const void> owner,
 	std::shared_ptr<Texture2D> &texture) const {
 
 	auto obj	= std::make_shared<Texture2D>();
 	texture		= obj;
 
+	//NOTE: The extension decides the loader, the bytes come from memory if there are any.
+	//		owner keeps them alive until the task is done.
+	std::wstring file( filename );
+
 	return create_task( [=]() -> void {
 		ComPtr<ID3D11CommandList> command;
 		//ComPtr<ID3D11DeviceContext1> context;
@@ -296,14 +306,34 @@ Concurrency::task<void> GraphicsManager::Impl::CreateTexture2DAsync(
 
 		//d3dDevice->CreateDeferredContext1(0, &context);
 
-		std::wstring file( filename );
 		std::wstring ending = L".dds";
 
-		if ( file.compare( file.length() - ending.length(), ending.length(), ending ) == 0 ) {
+		if ( data && file.compare( file.length() - ending.length(), ending.length(), ending ) == 0 ) {
+			Utility::ThrowIfFailed(
+				DirectX::CreateDDSTextureFromMemory(
+					d3dDevice.Get(),
+					data,
+					size,
+					resource.GetAddressOf(),
+					obj->resourceView.GetAddressOf()
+				)
+			);
+		} else if ( data ) {
+			Utility::ThrowIfFailed(
+				DirectX::CreateWICTextureFromMemory(
+					d3dDevice.Get(),
+					d3dContext.Get(),
+					data,
+					size,
+					resource.GetAddressOf(),
+					obj->resourceView.GetAddressOf()
+					)
+				);
+		} else if ( file.compare( file.length() - ending.length(), ending.length(), ending ) == 0 ) {
 			Utility::ThrowIfFailed(
 				DirectX::CreateDDSTextureFromFile(
 					d3dDevice.Get(),
-					filename,
+					file.c_str(),
 					resource.GetAddressOf(),
 					obj->resourceView.GetAddressOf()
 				)
@@ -313,7 +343,7 @@ Concurrency::task<void> GraphicsManager::Impl::CreateTexture2DAsync(
 				DirectX::CreateWICTextureFromFile(
 					d3dDevice.Get(),
 					d3dContext.Get(),
-					filename,
+					file.c_str(),
 					resource.GetAddressOf(),
 					obj->resourceView.GetAddressOf()
 					)
@@ -460,10 +490,19 @@ std::shared_ptr<SpriteFont> GraphicsManager::CreateSpriteFont( const wchar_t *fi
 	return result;
 }//CreateSpriteFont()
 
+std::shared_ptr<SpriteFont> GraphicsManager::CreateSpriteFont( const byte *data, std::size_t size ) const {
+	auto result = std::make_shared<SpriteFont>( pImpl->d3dDevice.Get(), data, size );
+	return result;
+}//CreateSpriteFont()
+
 std::shared_ptr<Texture2D> GraphicsManager::CreateTexture2D( const wchar_t *filename ) const {
+	return CreateTexture2D( filename, nullptr, 0, nullptr );
+}//CreateTexture2D()
+
+std::shared_ptr<Texture2D> GraphicsManager::CreateTexture2D( const wchar_t *filename, const byte *data, std::size_t size, std::shared_ptr<const void> owner ) const {
 	std::shared_ptr<Texture2D> texture;
 
-	pImpl->CreateTexture2DAsync( filename, texture ).then( []( Concurrency::task<void> t ) {
+	pImpl->CreateTexture2DAsync( filename, data, size, owner, texture ).then( []( Concurrency::task<void> t ) {
 		try {
 			t.get();
 		} catch( Platform::Exception ^e ) {
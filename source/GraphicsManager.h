@@ -57,8 +57,11 @@ namespace WinGame {
 			void SetDPI( float dpi );
 
 			std::shared_ptr<Texture2D>				CreateTexture2D( const wchar_t *filename ) const;
+			//The filename only picks the loader, owner keeps data alive until the texture is created
+			std::shared_ptr<Texture2D>				CreateTexture2D( const wchar_t *filename, const byte *data, std::size_t size, std::shared_ptr<const void> owner ) const;
 			std::shared_ptr<DirectX::SpriteBatch>	CreateSpriteBatch() const;
 			std::shared_ptr<DirectX::SpriteFont>	CreateSpriteFont( const wchar_t *filename ) const;
+			std::shared_ptr<DirectX::SpriteFont>	CreateSpriteFont( const byte *data, std::size_t size ) const;
 
 		private:
 			UTILITY_CLASS_COPY( GraphicsManager );
@@ -193,7 +193,6 @@ void HighscoreState::Resume() {
 }//Resume()
 
 void HighscoreState::Update( float elapsedTime, float totalTime ) {
-	pImpl->titleMusic->Update();
 	pImpl->guiManager->Update( gameManager );
 }//Update()
 
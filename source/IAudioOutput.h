@@ -0,0 +1,44 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace WinGame {
+	namespace Audio {
+		//NOTE: Receives the mixed 16 bit interleaved frames of a Mixer. Backends only need to
+		//		take the frames they said they had room for, the mixer keeps the rest buffered.
+		//		Any count is fine, odd ones included.
+		class IAudioOutput {
+		public:
+			virtual ~IAudioOutput() {
+			}
+
+			virtual bool Open( std::uint32_t sampleRate, std::uint32_t channelCount ) = 0;
+			virtual void Close() = 0;
+
+			virtual std::uint32_t	GetWritableFrames() const = 0;
+			virtual void			Write( const std::int16_t *frames, std::uint32_t frameCount ) = 0;
+
+		};//IAudioOutput interface
+	}//Audio namespace
+}//WinGame namespace
@@ -24,7 +24,10 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "GameObject.h"
+
+#ifndef BREAKIT_HEADLESS
 #include "Texture2D.h"
+#endif
 
 namespace BreakIt {
 	namespace Objects {
@@ -44,7 +47,9 @@ namespace BreakIt {
 			virtual ~IDrawableObject() {
 			}
 
+#ifndef BREAKIT_HEADLESS
 			virtual void Draw( DirectX::SpriteBatch *batch ) = 0;
+#endif
 
 			bool				IsVisible;
 			RECT				SourceRect;
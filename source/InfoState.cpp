@@ -198,7 +198,6 @@ void InfoState::Resume() {
 }//Resume()
 
 void InfoState::Update( float elapsedTime, float totalTime ) {
-	pImpl->titleMusic->Update();
 	pImpl->guiManager->Update( gameManager );
 }//Update()
 
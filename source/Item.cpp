@@ -44,6 +44,15 @@ Item::Item( float x, float y, const std::shared_ptr<WinGame::Graphics::Texture2D
 Item::~Item() {
 }//Dtor()
 
+void Item::Reset( float x, float y ) {
+	Position			= XMFLOAT2( x, y );
+	PreviousPosition	= Position;
+	IsInterpolated		= false;
+	IsVisible			= true;
+	Acceleration		= XMFLOAT2( 0.0f, 0.0f );
+	Velocity			= XMFLOAT2( 0.0f, MinimumItemSpeed );
+}//Reset()
+
 void Item::Update( float elapsedTime, float totalTime ) {
 	auto acc	= XMLoadFloat2( &Acceleration );
 	auto vel	= XMLoadFloat2( &Velocity );
@@ -57,20 +66,40 @@ void Item::Update( float elapsedTime, float totalTime ) {
 	XMStoreFloat2( &Position, pos );
 }//Update()
 
+#ifndef BREAKIT_HEADLESS
 void Item::DrawAnimated( SpriteBatch *batch, const RECT &sourceRECT ) {
 	if ( !Texture || !Texture->IsInitialized() || !IsVisible ) {
 		return;
 	}
 
+	auto pos = GetRenderPosition();
+
 	RECT dest = {
-		Utility::ftoi( Position.x ),
-		Utility::ftoi( Position.y ),
-		Utility::ftoi( Position.x + Size.x ),
-		Utility::ftoi( Position.y + Size.y )
+		Utility::ftoi( pos.x ),
+		Utility::ftoi( pos.y ),
+		Utility::ftoi( pos.x + Size.x ),
+		Utility::ftoi( pos.y + Size.y )
 	};
 
 	batch->Draw( Texture->GetResourceView(), dest, &sourceRECT, XMLoadFloat4( &RenderColor ), XMConvertToRadians( Rotation ), Origin );
 }//DrawAnimated()
+#endif
+
+void Item::SaveState( SnapshotWriter &writer ) const {
+	writer.Write( Position );
+	writer.Write( Velocity );
+	writer.Write( Acceleration );
+	writer.Write( IsVisible );
+}//SaveState()
+
+void Item::LoadState( SnapshotReader &reader ) {
+	reader.Read( Position );
+	reader.Read( Velocity );
+	reader.Read( Acceleration );
+	reader.Read( IsVisible );
+
+	StorePreviousPosition();
+}//LoadState()
 
 bool Item::IsRemoveReady( const std::unique_ptr<Item> &item ) {
 	return !item->IsVisible;
@@ -26,6 +26,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "DrawableObject.h"
 #include "Player.h"
 #include "BallManager.h"
+#include "Snapshot.h"
 
 namespace BreakIt {
 	namespace Objects {
@@ -34,10 +35,18 @@ namespace BreakIt {
 			explicit Item( float x, float y, const std::shared_ptr<WinGame::Graphics::Texture2D> &texture );
 			virtual ~Item();
 
+			//Puts a pooled item back into the state a new one would have
+			void Reset( float x, float y );
+
 			virtual void Update( float elapsedTime, float totalTime ) override;
 			virtual void ApplyEffect( Player *player = nullptr, BallManager *balls = nullptr ) = 0;
 
+#ifndef BREAKIT_HEADLESS
 			void DrawAnimated( DirectX::SpriteBatch *batch, const RECT &sourceRECT );
+#endif
+			void SaveState( SnapshotWriter &writer ) const;
+			void LoadState( SnapshotReader &reader );
+
 			static bool IsRemoveReady( const std::unique_ptr<Item> &item );
 
 			DirectX::XMFLOAT2 Acceleration;
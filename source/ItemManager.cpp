@@ -25,6 +25,9 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "ItemManager.h"
 #include "BallManager.h"
 #include "Globals.h"
+#include "ObjectPool.h"
+#include "Random.h"
+#include <cmath>
 #include "Coin.h"
 #include "Heart.h"
 #include "Diamond.h"
@@ -51,58 +54,49 @@ struct ItemAnimation {
 	float				TimeCounter;
 	float				TimePerFrame;
 
-	ItemAnimation( std::uint32_t frames, float time ) :
+	ItemAnimation() :
+		FrameRects( 0 ),
 		FrameCounter( 0 ),
-		MaximumFrames( frames ),
+		MaximumFrames( 0 ),
 		TimeCounter( 0.0f ),
-		TimePerFrame( time ),
-		FrameRects( 0 ) {
+		TimePerFrame( 0.0f ) {
 	}//Ctor()
 
 };//ItemAnimation strcut
 
-struct ItemSpawnChance {
-	double		Weight;
-	ITEM_TYPES	Type;
-
-	ItemSpawnChance( ITEM_TYPES type, double weight ) :
-		Weight( weight ),
-		Type( type ) {
-	}//Ctor()
-
-	bool operator<( const ItemSpawnChance &rhs ) const {
-		return Weight < rhs.Weight;
-	}
-};//ItemSpawnChance struct
-
 class ItemManager::Impl {
 public:
 	Impl();
 
 	bool isWidescreen;
 
-	//Resources
-	std::shared_ptr<Texture2D>									itemTexture;
-	std::map<ITEM_TYPES, std::unique_ptr<Item>>					staticItems;
-	std::map<ITEM_TYPES, std::unique_ptr<ItemAnimation>>		animation;
-	std::map<ITEM_TYPES, std::vector<std::unique_ptr<Item>>>	items;
+	//Resources, every array is indexed by ITEM_TYPES so the per frame passes are linear scans
+	std::shared_ptr<Texture2D>			itemTexture;
+	std::unique_ptr<Item>				staticItems[ItemTypeCount];
+	ItemAnimation						animation[ItemTypeCount];
+	std::vector<std::unique_ptr<Item>>	items[ItemTypeCount];
+	ObjectPool<Item>					pools[ItemTypeCount];
 
 	//Random Vars
-	std::default_random_engine				engine;
-	std::uniform_real_distribution<double>	distribution;
-	std::vector<ItemSpawnChance>			spawnChance;
-	double									maximumWeight;
+	Random							random;
+	std::uint32_t					seed;
+	AliasTable						spawnTable;
+
+	//Statistics
+	std::uint32_t collectedCount;
 
 	//Methods
 	void AddAnimation( ITEM_TYPES type, std::uint32_t frames, float time, LONG left, LONG top );
 	void AddStaticItems();
+	void AddPools();
 	void InitRandom();
 
 	std::unique_ptr<Item> CreateItem( float x, float y, ITEM_TYPES type );
+	std::unique_ptr<Item> SpawnItem( float x, float y, ITEM_TYPES type );
 
 	template<typename T>
 	void AddStatic( ITEM_TYPES type ) {
-		staticItems[type] = std::make_unique<T>(
+		staticItems[static_cast<std::uint32_t>( type )] = std::make_unique<T>(
 			0.0f,
 			0.0f,
 			itemTexture
@@ -114,9 +108,8 @@ public:
 ItemManager::Impl::Impl() :
 	isWidescreen( false ),
 	itemTexture( nullptr ),
-	staticItems(),
-	animation(),
-	items() {
+	seed( 0 ),
+	collectedCount( 0 ) {
 }//Ctor()
 
 std::unique_ptr<Item> ItemManager::Impl::CreateItem( float x, float y, ITEM_TYPES type ) {
@@ -198,31 +191,27 @@ std::unique_ptr<Item> ItemManager::Impl::CreateItem( float x, float y, ITEM_TYPE
 	}
 }//CreateItem()
 
-void ItemManager::Impl::InitRandom() {
-	spawnChance.clear();
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::COIN, 400.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::HEART, 2.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::DIAMOND, 0.05 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::FIRST_AID, 0.09 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::DEATH_BALL, 7.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::EXTRA_BALL, 8.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::STEEL_WALL, 6.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::LASER_GUN, 10.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::INVISIBLE_BALL, 0.9 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::SOFT_BALL, 11.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::PADDLE_ENLARGE, 12.0 ) );
-	spawnChance.push_back( ItemSpawnChance( ITEM_TYPES::PADDLE_SHRINK, 11.5 ) );
-	std::sort( std::begin( spawnChance ), std::end( spawnChance ) );
-
-	maximumWeight = 0.0;
-	for ( const auto &chance : spawnChance ) {
-		maximumWeight += chance.Weight;
+std::unique_ptr<Item> ItemManager::Impl::SpawnItem( float x, float y, ITEM_TYPES type ) {
+	auto index = static_cast<std::uint32_t>( type );
+
+	if ( index < ItemTypeCount ) {
+		auto item = pools[index].Acquire();
+
+		if ( item ) {
+			item->Reset( x, y );
+			return item;
+		}
 	}
 
-	_SYSTEMTIME time;
-	GetSystemTime( &time );
-	engine.seed( time.wHour + time.wMinute + time.wSecond + time.wMilliseconds );
-	distribution = std::uniform_real_distribution<double>( 0.0, maximumWeight - 1.0 );
+	return CreateItem( x, y, type );
+}//SpawnItem()
+
+void ItemManager::Impl::InitRandom() {
+	spawnTable.Build( std::vector<double>( ItemDropWeights, ItemDropWeights + ItemTypeCount ) );
+
+	//Replays and batch runs set their own seed, any changing value will do here
+	seed = Random::GetClockSeed();
+	random.Seed( seed, RANDOM_STREAM::ITEM_DROPS );
 }//InitRandom()
 
 void ItemManager::Impl::AddStaticItems() {
@@ -240,10 +229,30 @@ void ItemManager::Impl::AddStaticItems() {
 	AddStatic<PadShrink>( ITEM_TYPES::PADDLE_SHRINK );
 }//AddStaticItems()
 
+//NOTE: One pool per item type, a pooled item is always handed out as the type it was made as.
+void ItemManager::Impl::AddPools() {
+	for ( std::uint32_t i = 0; i < ItemTypeCount; ++i ) {
+		auto type = static_cast<ITEM_TYPES>( i );
+
+		pools[i].Clear();
+		pools[i].Reserve( ItemPoolSize, [this, type]() {
+			return CreateItem( 0.0f, 0.0f, type );
+		} );
+
+		items[i].reserve( ItemPoolSize );
+	}
+}//AddPools()
+
 void ItemManager::Impl::AddAnimation( ITEM_TYPES type, std::uint32_t frames, float time, LONG left, LONG top ) {
-	auto ani = std::make_unique<ItemAnimation>( frames, time );
+	auto ani = &animation[static_cast<std::uint32_t>( type )];
 	RECT sourceRect;
 
+	ani->FrameCounter	= 0;
+	ani->MaximumFrames	= frames;
+	ani->TimeCounter	= 0.0f;
+	ani->TimePerFrame	= time;
+	ani->FrameRects.clear();
+
 	sourceRect.top		= top;
 	sourceRect.bottom	= sourceRect.top + Utility::ftoi( ItemTextureHeight );
 	
@@ -252,12 +261,6 @@ void ItemManager::Impl::AddAnimation( ITEM_TYPES type, std::uint32_t frames, flo
 		sourceRect.right	= sourceRect.left + Utility::ftoi( ItemTextureWidth );
 		ani->FrameRects.push_back( sourceRect );
 	}
-
-	if ( animation[type] ) {
-		animation[type] = nullptr;
-	}
-
-	animation[type] = std::move( ani );
 }//AddAnimation()
 
 ItemManager::ItemManager() :
@@ -280,7 +283,6 @@ void ItemManager::Initialize( const std::shared_ptr<Texture2D> &texture, bool wi
 	Clear(); //Clear Everything
 
 	//Add Animations
-	pImpl->animation.clear();
 	pImpl->AddAnimation( ITEM_TYPES::COIN, 8, 0.08f, 0, 0 );
 	pImpl->AddAnimation( ITEM_TYPES::HEART, 4, 0.08f, 0, 102 );
 	pImpl->AddAnimation( ITEM_TYPES::DEATH_BALL, 1, 0.0f, 0, 188 );
@@ -295,41 +297,138 @@ void ItemManager::Initialize( const std::shared_ptr<Texture2D> &texture, bool wi
 	pImpl->AddAnimation( ITEM_TYPES::STEEL_WALL, 1, 0.0f, 196, 102 );
 
 	//Add Static Items
-	pImpl->staticItems.clear();
 	pImpl->AddStaticItems();
 
+	//Pooled items still point at the previous texture
+	pImpl->AddPools();
+
 	//Init Everything else
 	pImpl->InitRandom();
 	Resize( widescreen );
 }//Initialize()
 
+void ItemManager::SetSeed( std::uint32_t seed ) {
+	pImpl->seed = seed;
+	pImpl->random.Seed( seed, RANDOM_STREAM::ITEM_DROPS );
+}//SetSeed()
+
+std::uint32_t ItemManager::GetSeed() const {
+	return pImpl->seed;
+}//GetSeed()
+
+std::uint32_t ItemManager::GetCollectedCount() const {
+	return pImpl->collectedCount;
+}//GetCollectedCount()
+
+void ItemManager::ResetCollectedCount() {
+	pImpl->collectedCount = 0;
+}//ResetCollectedCount()
+
+void ItemManager::SaveState( SnapshotWriter &writer ) const {
+	std::uint32_t state[4];
+
+	pImpl->random.GetState( state );
+	writer.Write( pImpl->seed );
+	writer.Write( state );
+
+	writer.Write( ItemTypeCount );
+	for ( std::uint32_t i = 0; i < ItemTypeCount; ++i ) {
+		writer.Write( static_cast<ITEM_TYPES>( i ) );
+		writer.Write( pImpl->animation[i].FrameCounter );
+		writer.Write( pImpl->animation[i].TimeCounter );
+	}
+
+	writer.Write( ItemTypeCount );
+	for ( std::uint32_t i = 0; i < ItemTypeCount; ++i ) {
+		writer.Write( static_cast<ITEM_TYPES>( i ) );
+		writer.Write( static_cast<std::uint32_t>( pImpl->items[i].size() ) );
+
+		for ( const auto &item : pImpl->items[i] ) {
+			item->SaveState( writer );
+		}
+	}
+}//SaveState()
+
+void ItemManager::LoadState( SnapshotReader &reader ) {
+	std::uint32_t	state[4]	= { 0, 0, 0, 0 };
+	std::uint32_t	seed		= 0;
+	std::uint32_t	count		= 0;
+	ITEM_TYPES		type;
+
+	reader.Read( seed );
+	reader.Read( state );
+
+	pImpl->seed = seed;
+	if ( ( state[0] | state[1] | state[2] | state[3] ) != 0 ) {
+		pImpl->random.SetState( state );
+	} else {
+		pImpl->random.Seed( seed, RANDOM_STREAM::ITEM_DROPS );
+	}
+
+	reader.Read( count );
+	for ( std::uint32_t i = 0; i < count && reader.IsValid(); ++i ) {
+		std::uint32_t	frame	= 0;
+		float			time	= 0.0f;
+
+		reader.Read( type );
+		reader.Read( frame );
+		reader.Read( time );
+
+		auto index = static_cast<std::uint32_t>( type );
+		if ( index >= ItemTypeCount ) {
+			reader.Invalidate();
+		} else if ( frame < pImpl->animation[index].MaximumFrames ) {
+			pImpl->animation[index].FrameCounter	= frame;
+			pImpl->animation[index].TimeCounter		= time;
+		}
+	}
+
+	Clear();
+	reader.Read( count );
+	for ( std::uint32_t i = 0; i < count && reader.IsValid(); ++i ) {
+		std::uint32_t size = 0;
+
+		reader.Read( type );
+		reader.Read( size );
+
+		if ( static_cast<std::uint32_t>( type ) >= ItemTypeCount ) {
+			reader.Invalidate();
+			return;
+		}
+
+		for ( std::uint32_t j = 0; j < size && reader.IsValid(); ++j ) {
+			auto item = pImpl->SpawnItem( 0.0f, 0.0f, type );
+			if ( !item ) {
+				reader.Invalidate();
+				return;
+			}
+
+			item->LoadState( reader );
+			pImpl->items[static_cast<std::uint32_t>( type )].push_back( std::move( item ) );
+		}
+	}
+}//LoadState()
+
 void ItemManager::Clear() {
-	pImpl->items[ITEM_TYPES::COIN].clear();
-	pImpl->items[ITEM_TYPES::HEART].clear();
-	pImpl->items[ITEM_TYPES::DIAMOND].clear();
-	pImpl->items[ITEM_TYPES::FIRST_AID].clear();
-	pImpl->items[ITEM_TYPES::DEATH_BALL].clear();
-	pImpl->items[ITEM_TYPES::EXTRA_BALL].clear();
-	pImpl->items[ITEM_TYPES::STEEL_WALL].clear();
-	pImpl->items[ITEM_TYPES::LASER_GUN].clear();
-	pImpl->items[ITEM_TYPES::INVISIBLE_BALL].clear();
-	pImpl->items[ITEM_TYPES::SOFT_BALL].clear();
-	pImpl->items[ITEM_TYPES::PADDLE_ENLARGE].clear();
-	pImpl->items[ITEM_TYPES::PADDLE_SHRINK].clear();
+	for ( std::uint32_t i = 0; i < ItemTypeCount; ++i ) {
+		pImpl->pools[i].CollectAll( pImpl->items[i] );
+	}
 }//Clear()
 
 void ItemManager::Resize( bool widescreen ) {
 	if ( pImpl->isWidescreen != widescreen ) {
 		if ( pImpl->isWidescreen && !widescreen ) {
-			for ( auto &map : pImpl->items ) {
-				for ( auto &item : map.second ) {
+			for ( auto &list : pImpl->items ) {
+				for ( auto &item : list ) {
 					item->Position.x -= SidebarWidth;
+					item->StorePreviousPosition();
 				}
 			}
 		} else if ( !pImpl->isWidescreen && widescreen ) {
-			for ( auto &map : pImpl->items ) {
-				for ( auto &item : map.second ) {
+			for ( auto &list : pImpl->items ) {
+				for ( auto &item : list ) {
 					item->Position.x += SidebarWidth;
+					item->StorePreviousPosition();
 				}
 			}
 		}
@@ -339,35 +438,47 @@ void ItemManager::Resize( bool widescreen ) {
 }//Resize()
 
 void ItemManager::Animate( float elapsedTime ) {
-	for ( auto &map : pImpl->animation ) {
-		map.second->TimeCounter += elapsedTime;
+	for ( auto &ani : pImpl->animation ) {
+		ani.TimeCounter += elapsedTime;
 
-		if ( map.second->TimeCounter >= map.second->TimePerFrame ) {
-			map.second->TimeCounter = 0.0f;
-			++map.second->FrameCounter;
+		if ( ani.TimeCounter >= ani.TimePerFrame ) {
+			ani.TimeCounter = 0.0f;
+			++ani.FrameCounter;
 
-			if ( map.second->FrameCounter >= map.second->MaximumFrames ) {
-				map.second->FrameCounter = 0;
+			if ( ani.FrameCounter >= ani.MaximumFrames ) {
+				ani.FrameCounter = 0;
 			}
 		}
 	}
 }//Animate()
 
-void ItemManager::Update( Player *player, BallManager *balls, SoundManager *sounds, float elapsedTime, float totalTime ) {
+void ItemManager::StorePreviousPositions() {
+	for ( auto &list : pImpl->items ) {
+		for ( auto &item : list ) {
+			item->StorePreviousPosition();
+		}
+	}
+}//StorePreviousPositions()
+
+void ItemManager::Update( Player *player, BallManager *balls, ISoundObserver *sounds, float elapsedTime, float totalTime ) {
 	bool hit = false;
 
 	//Coin* coin = nullptr;
 	//Heart* heart = nullptr;
 
-	for ( auto &map : pImpl->items ) {
+	for ( std::uint32_t i = 0; i < ItemTypeCount; ++i ) {
+		auto &list = pImpl->items[i];
 		hit = false;
 
-		for ( auto &item : map.second ) {
+		for ( auto &item : list ) {
 			item->Update( elapsedTime, totalTime );
 
 			if ( player->IsTouching( item.get() ) ) {
-				sounds->PlayItemSound( map.first );
+				if ( sounds ) {
+					sounds->PlayItemSound( static_cast<ITEM_TYPES>( i ) );
+				}
 				item->ApplyEffect( player, balls );
+				++pImpl->collectedCount;
 
 				item->IsVisible = false;
 				hit				= true;
@@ -378,42 +489,39 @@ void ItemManager::Update( Player *player, BallManager *balls, SoundManager *soun
 		}
 
 		if ( hit ) {
-			map.second.erase(
-				std::remove_if(
-					std::begin( map.second ),
-					std::end( map.second ),
-					Item::IsRemoveReady
-					),
-				std::end( map.second )
-				);
+			pImpl->pools[i].Collect( list, Item::IsRemoveReady );
 		}
 	}
 }//Update()
 
+#ifndef BREAKIT_HEADLESS
 void ItemManager::Draw( SpriteBatch *batch ) {
-	ItemAnimation* ani = nullptr;
+	for ( std::uint32_t i = 0; i < ItemTypeCount; ++i ) {
+		if ( pImpl->items[i].empty() ) {
+			continue;
+		}
 
-	for ( auto &map : pImpl->items ) {
-		ani = pImpl->animation[map.first].get();
+		const auto &frame = pImpl->animation[i].FrameRects[pImpl->animation[i].FrameCounter];
 
-		for ( auto &item : map.second ) {
-			item->DrawAnimated( batch, ani->FrameRects[ani->FrameCounter] );
+		for ( auto &item : pImpl->items[i] ) {
+			item->DrawAnimated( batch, frame );
 		}
 	}
 }//Draw()
 
 void ItemManager::DrawStatic( SpriteBatch *batch, ITEM_TYPES type, float x, float y ) {
-	auto ani	= pImpl->animation[type].get();
-	auto item	= pImpl->staticItems[type].get();
+	auto ani	= &pImpl->animation[static_cast<std::uint32_t>( type )];
+	auto item	= pImpl->staticItems[static_cast<std::uint32_t>( type )].get();
 
 	item->Position.x = x;
 	item->Position.y = y;
 	item->DrawAnimated( batch, ani->FrameRects[ani->FrameCounter] );
 }//Draw()
+#endif
 
 void ItemManager::GiveAll( Player *player, BallManager *balls ) {
-	for ( auto &map : pImpl->items ) {
-		for ( auto &item : map.second ) {
+	for ( auto &list : pImpl->items ) {
+		for ( auto &item : list ) {
 			item->ApplyEffect( player, balls );
 		}
 	}
@@ -422,23 +530,13 @@ void ItemManager::GiveAll( Player *player, BallManager *balls ) {
 }//GiveAll()
 
 void ItemManager::AddItem( float x, float y ) {
-	auto rnd = pImpl->distribution( pImpl->engine );
-	decltype( rnd ) weight = 0.0;
-
-	for ( const auto &chance : pImpl->spawnChance ) {
-		weight += chance.Weight;
-
-		if ( weight > rnd ) {
-			pImpl->items[chance.Type].push_back(
-				std::move(
-					pImpl->CreateItem(
-						x, 
-						y, 
-						chance.Type
-						)
-					)
-				);
-			break;
-		}
-	}
+	auto type = static_cast<ITEM_TYPES>( pImpl->spawnTable.Sample( pImpl->random ) );
+
+	pImpl->items[static_cast<std::uint32_t>( type )].push_back(
+		pImpl->SpawnItem(
+			x,
+			y,
+			type
+			)
+		);
 }//AddItem()
@@ -24,7 +24,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "Player.h"
-#include "SoundManager.h"
+#include "ISoundObserver.h"
 #include "Globals.h"
 
 namespace BreakIt {
@@ -41,10 +41,21 @@ namespace BreakIt {
 			void Clear();
 			void Resize( bool widescreen );
 			void Animate( float elapsedTime );
-			void Update( Player *player, BallManager *balls, SoundManager *sounds, float elapsedTime, float totalTime );
+			void StorePreviousPositions();
+			void Update( Player *player, BallManager *balls, ISoundObserver *sounds, float elapsedTime, float totalTime );
+#ifndef BREAKIT_HEADLESS
 			void Draw( DirectX::SpriteBatch *batch );
 			void DrawStatic( DirectX::SpriteBatch *batch, ITEM_TYPES type, float x, float y );
+#endif
 			
+			void			SetSeed( std::uint32_t seed );
+			std::uint32_t	GetSeed() const;
+			std::uint32_t	GetCollectedCount() const;
+			void			ResetCollectedCount();
+
+			void SaveState( SnapshotWriter &writer ) const;
+			void LoadState( SnapshotReader &reader );
+
 			void GiveAll( Player *player, BallManager *balls );
 			void AddItem( float x, float y );
 
@@ -51,6 +51,15 @@ Laser::Laser( float x, float y, const std::shared_ptr<WinGame::Graphics::Texture
 Laser::~Laser() {
 }//Dtor()
 
+void Laser::Reset( float x, float y ) {
+	Position			= XMFLOAT2( x, y );
+	PreviousPosition	= Position;
+	IsInterpolated		= false;
+	IsVisible			= true;
+	Acceleration		= XMFLOAT2( 0.0f, 0.0f );
+	Velocity			= XMFLOAT2( 0.0f, -250.0f );
+}//Reset()
+
 void Laser::Update( float elapsedTime, float totalTime ) {
 	auto acc = XMLoadFloat2( &Acceleration );
 	auto vel = XMLoadFloat2( &Velocity );
@@ -67,3 +76,19 @@ void Laser::Update( float elapsedTime, float totalTime ) {
 bool Laser::IsRemoveReady( const std::unique_ptr<Laser> &laser ) {
 	return !laser->IsVisible;
 }//IsRemoveReady()
+
+void Laser::SaveState( SnapshotWriter &writer ) const {
+	writer.Write( Position );
+	writer.Write( Velocity );
+	writer.Write( Acceleration );
+	writer.Write( IsVisible );
+}//SaveState()
+
+void Laser::LoadState( SnapshotReader &reader ) {
+	reader.Read( Position );
+	reader.Read( Velocity );
+	reader.Read( Acceleration );
+	reader.Read( IsVisible );
+
+	StorePreviousPosition();
+}//LoadState()
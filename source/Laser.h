@@ -24,6 +24,7 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "DrawableObject.h"
+#include "Snapshot.h"
 
 namespace BreakIt {
 	namespace Objects {
@@ -32,8 +33,14 @@ namespace BreakIt {
 			explicit Laser( float x, float y, const std::shared_ptr<WinGame::Graphics::Texture2D> &texture );
 			virtual ~Laser();
 
+			//Puts a pooled laser back into the state a new one would have
+			void Reset( float x, float y );
+
 			virtual void Update( float elapsedTime, float totalTime ) override;
 
+			void SaveState( SnapshotWriter &writer ) const;
+			void LoadState( SnapshotReader &reader );
+
 			static bool IsRemoveReady( const std::unique_ptr<Laser> &laser );
 
 			DirectX::XMFLOAT2 Acceleration;
@@ -81,6 +81,16 @@ void LoadingState::Impl::LoadData( GameManager *manager ) {
 		//auto graphics = manager->GetGraphicsManager();
 		auto audio = manager->GetAudioManager();
 
+		//Without a bank every sound is decoded when it is first loaded. Inside the pack it
+		//is used straight from the mapping, as long as it was stored uncompressed.
+		auto bank = content->LoadAsset( SoundBankFilename.c_str() );
+
+		if ( bank ) {
+			audio->LoadSoundBank( bank->GetData(), bank->GetSize(), bank );
+		} else {
+			audio->LoadSoundBank( SoundBankFilename.c_str() );
+		}
+
 		//Preload Music
 		titleMusic = content->LoadMusic( audio, MusicFilename.c_str() );
 
@@ -161,7 +161,16 @@ bool MapLoadingState::Impl::LoadMap( GameManager *manager ) {
 	if ( !mapLoadingStarted ) {
 		//Load Map
 		map->Initialize( manager );
-		map->Load( manager->GetStyleManager()->GetLevelFilename( levelIndex ) );
+
+		auto filename	= manager->GetStyleManager()->GetLevelFilename( levelIndex );
+		auto asset		= manager->GetGameplayContent()->LoadAsset( filename );
+
+		if ( asset ) {
+			map->LoadBitmap( asset->GetData(), asset->GetSize() );
+		} else {
+			map->Load( filename );
+		}
+
 		map->SetLevelIndex( levelIndex );
 
 		if ( isResumed ) {
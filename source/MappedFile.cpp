@@ -0,0 +1,104 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+#include "pch.h"
+#include "MappedFile.h"
+
+using namespace WinGame;
+using namespace WinGame::Content;
+
+MappedFile::MappedFile() :
+	file( INVALID_HANDLE_VALUE ),
+	mapping( nullptr ),
+	view( nullptr ),
+	size( 0 ) {
+}//Ctor()
+
+MappedFile::~MappedFile() {
+	Close();
+}//Dtor()
+
+bool MappedFile::Open( const wchar_t *filename ) {
+	Close();
+
+	file = CreateFile2( filename, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr );
+
+	if ( file == INVALID_HANDLE_VALUE ) {
+		return false;
+	}
+
+	FILE_STANDARD_INFO info;
+
+	//An empty file can not be mapped
+	if ( !GetFileInformationByHandleEx( file, FileStandardInfo, &info, sizeof( info ) ) || info.EndOfFile.QuadPart <= 0 ) {
+		Close();
+		return false;
+	}
+
+	size	= static_cast<std::uint64_t>( info.EndOfFile.QuadPart );
+	mapping	= CreateFileMappingFromApp( file, nullptr, PAGE_READONLY, 0, nullptr );
+
+	if ( !mapping ) {
+		Close();
+		return false;
+	}
+
+	view = static_cast<const byte*>( MapViewOfFileFromApp( mapping, FILE_MAP_READ, 0, 0 ) );
+
+	if ( !view ) {
+		Close();
+		return false;
+	}
+
+	return true;
+}//Open()
+
+void MappedFile::Close() {
+	if ( view ) {
+		UnmapViewOfFile( view );
+	}
+
+	if ( mapping ) {
+		CloseHandle( mapping );
+	}
+
+	if ( file != INVALID_HANDLE_VALUE ) {
+		CloseHandle( file );
+	}
+
+	file	= INVALID_HANDLE_VALUE;
+	mapping	= nullptr;
+	view	= nullptr;
+	size	= 0;
+}//Close()
+
+bool MappedFile::IsOpen() const {
+	return view != nullptr;
+}//IsOpen()
+
+const byte* MappedFile::GetData() const {
+	return view;
+}//GetData()
+
+std::uint64_t MappedFile::GetSize() const {
+	return size;
+}//GetSize()
@@ -0,0 +1,55 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+#pragma once
+
+namespace WinGame {
+	namespace Content {
+		//NOTE: A whole file mapped into memory read only. Pages are read by the OS the first
+		//		time they are touched, so opening is one system call no matter how large the
+		//		file is and nothing is copied into the heap.
+		class MappedFile {
+		public:
+			explicit MappedFile();
+			~MappedFile();
+
+			//Returns false if the file is missing or empty
+			bool Open( const wchar_t *filename );
+			void Close();
+			bool IsOpen() const;
+
+			const byte*		GetData() const;
+			std::uint64_t	GetSize() const;
+
+		private:
+			MappedFile( const MappedFile& );
+			MappedFile& operator=( const MappedFile& );
+
+			HANDLE			file;
+			HANDLE			mapping;
+			const byte		*view;
+			std::uint64_t	size;
+
+		};//MappedFile class
+
+	}//Content namespace
+}//WinGame namespace
@@ -300,7 +300,6 @@ void MenuState::Update( float elapsedTime, float totalTime )
 		switchedMode = true;
 	}
 
-	pImpl->titleMusic->Update();
 	pImpl->objLogo->Update( elapsedTime, totalTime );
 	pImpl->guiManager->Update( gameManager );
 }//Update()
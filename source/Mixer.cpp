@@ -0,0 +1,427 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "Mixer.h"
+#include <DirectXPackedVector.h>
+#include <chrono>
+#include <fstream>
+
+using namespace WinGame;
+using namespace WinGame::Audio;
+using namespace DirectX;
+using namespace DirectX::PackedVector;
+
+struct MixerVoice {
+	const PcmBuffer	*Pcm;		//nullptr while the voice is free
+	std::uint32_t	Position;
+	float			Gain[2];
+	std::uint64_t	PlayIndex;
+};//MixerVoice struct
+
+static std::uint16_t ReadUInt16( const std::vector<char> &data, std::size_t offset ) {
+	return static_cast<std::uint16_t>(
+		static_cast<std::uint8_t>( data[offset] ) |
+		( static_cast<std::uint8_t>( data[offset + 1] ) << 8 )
+		);
+}//ReadUInt16()
+
+static std::uint32_t ReadUInt32( const std::vector<char> &data, std::size_t offset ) {
+	return ReadUInt16( data, offset ) | ( static_cast<std::uint32_t>( ReadUInt16( data, offset + 2 ) ) << 16 );
+}//ReadUInt32()
+
+bool WinGame::Audio::LoadWaveFile( const std::string &filename, PcmBuffer &pcm ) {
+	std::ifstream file( filename.c_str(), std::ios::binary );
+
+	if ( !file.is_open() ) {
+		return false;
+	}
+
+	std::vector<char> data( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+
+	if ( data.size() < 12 || std::string( &data[0], 4 ) != "RIFF" || std::string( &data[8], 4 ) != "WAVE" ) {
+		return false;
+	}
+
+	bool			hasFormat		= false;
+	std::uint32_t	channelCount	= 0;
+	std::uint32_t	sampleRate		= 0;
+	std::size_t		offset			= 12;
+
+	//Walk the chunks, they are padded to an even size
+	while ( offset + 8 <= data.size() ) {
+		std::string		id( &data[offset], 4 );
+		std::uint32_t	size	= ReadUInt32( data, offset + 4 );
+		std::size_t		start	= offset + 8;
+
+		if ( start + size > data.size() ) {
+			return false;
+		}
+
+		if ( id == "fmt " && size >= 16 ) {
+			std::uint16_t formatTag = ReadUInt16( data, start );
+
+			//WAVE_FORMAT_EXTENSIBLE keeps the actual format in its sub format GUID
+			if ( formatTag == 0xFFFE && size >= 40 ) {
+				formatTag = ReadUInt16( data, start + 24 );
+			}
+
+			channelCount	= ReadUInt16( data, start + 2 );
+			sampleRate		= ReadUInt32( data, start + 4 );
+			hasFormat		= formatTag == 1 && ReadUInt16( data, start + 14 ) == 16 && ( channelCount == 1 || channelCount == 2 );
+
+			if ( !hasFormat ) {
+				return false;
+			}
+		} else if ( id == "data" && hasFormat ) {
+			std::uint32_t frameCount = size / ( channelCount * sizeof( std::int16_t ) );
+
+			pcm.ChannelCount	= channelCount;
+			pcm.SampleRate		= sampleRate;
+			pcm.FrameCount		= frameCount;
+			pcm.Samples.assign( ( frameCount + 1 ) * channelCount, 0 );
+
+			for ( std::size_t i = 0; i < frameCount * channelCount; ++i ) {
+				pcm.Samples[i] = static_cast<std::int16_t>( ReadUInt16( data, start + i * 2 ) );
+			}
+
+			return true;
+		}
+
+		offset = start + size + ( size & 1 );
+	}
+
+	return false;
+}//LoadWaveFile()
+
+class Mixer::Impl {
+public:
+	Impl();
+
+	std::unique_ptr<IAudioOutput>	output;
+	MixerVoice						voices[MixerVoiceCount];
+	std::vector<float>				block;
+	std::vector<std::int16_t>		ring;
+
+	std::uint64_t	readFrame;
+	std::uint64_t	writeFrame;
+	float			pendingFrames;
+
+	std::uint64_t	playCount;
+	std::uint64_t	stealCount;
+	std::uint64_t	droppedCount;
+	std::uint64_t	mixedFrames;
+	double			mixTime;
+
+#if _DEBUG
+	std::uint64_t	reportFrames;
+#endif
+
+	void MixVoice( MixerVoice &voice, std::uint32_t frameCount );
+	void MixBlock( std::uint32_t frameCount );
+	void Drain();
+};//Mixer::Impl class
+
+Mixer::Impl::Impl() :
+	block( MixerBlockFrames * MixerChannelCount, 0.0f ),
+	ring( MixerRingFrames * MixerChannelCount, 0 ),
+	readFrame( 0 ),
+	writeFrame( 0 ),
+	pendingFrames( 0.0f ),
+	playCount( 0 ),
+	stealCount( 0 ),
+	droppedCount( 0 ),
+	mixedFrames( 0 ),
+	mixTime( 0.0 ) {
+
+	for ( auto &voice : voices ) {
+		voice.Pcm		= nullptr;
+		voice.Position	= 0;
+		voice.Gain[0]	= 0.0f;
+		voice.Gain[1]	= 0.0f;
+		voice.PlayIndex	= 0;
+	}
+
+#if _DEBUG
+	reportFrames = 0;
+#endif
+}//Ctor()
+
+//NOTE: Adds two frames per iteration, a stereo pair is (l0 r0 l1 r1) and a mono pair is
+//		(s0 s1) spread to (s0 s0 s1 s1), both times (left right left right) gain.
+void Mixer::Impl::MixVoice( MixerVoice &voice, std::uint32_t frameCount ) {
+	auto pcm		= voice.Pcm;
+	auto frames		= std::min<std::uint32_t>( frameCount, pcm->FrameCount - voice.Position );
+	auto pairs		= ( frames + 1 ) / 2;
+	auto source		= &pcm->Samples[voice.Position * pcm->ChannelCount];
+	auto target		= &block[0];
+	XMVECTOR gain	= XMVectorSet( voice.Gain[0], voice.Gain[1], voice.Gain[0], voice.Gain[1] );
+
+	if ( pcm->ChannelCount == 2 ) {
+		for ( std::uint32_t i = 0; i < pairs; ++i ) {
+			XMVECTOR samples	= XMLoadShortN4( reinterpret_cast<const XMSHORTN4*>( source + i * 4 ) );
+			XMVECTOR mix		= XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( target + i * 4 ) );
+
+			XMStoreFloat4( reinterpret_cast<XMFLOAT4*>( target + i * 4 ), XMVectorMultiplyAdd( samples, gain, mix ) );
+		}
+	} else {
+		for ( std::uint32_t i = 0; i < pairs; ++i ) {
+			XMVECTOR samples	= XMLoadShortN2( reinterpret_cast<const XMSHORTN2*>( source + i * 2 ) );
+			XMVECTOR mix		= XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( target + i * 4 ) );
+
+			samples = XMVectorSwizzle( samples, 0, 0, 1, 1 );
+			XMStoreFloat4( reinterpret_cast<XMFLOAT4*>( target + i * 4 ), XMVectorMultiplyAdd( samples, gain, mix ) );
+		}
+	}
+
+	voice.Position += frames;
+
+	if ( voice.Position >= pcm->FrameCount ) {
+		voice.Pcm = nullptr;
+	}
+}//MixVoice()
+
+void Mixer::Impl::MixBlock( std::uint32_t frameCount ) {
+	std::fill( std::begin( block ), std::begin( block ) + frameCount * MixerChannelCount, 0.0f );
+
+	for ( auto &voice : voices ) {
+		if ( voice.Pcm ) {
+			MixVoice( voice, frameCount );
+		}
+	}
+
+	//Clamp and convert into the ring, writeFrame is always even so a pair never wraps
+	XMVECTOR maximum = XMVectorSplatOne();
+	XMVECTOR minimum = XMVectorNegate( maximum );
+
+	for ( std::uint32_t i = 0; i < frameCount; i += 2 ) {
+		auto		index	= static_cast<std::uint32_t>( ( writeFrame + i ) & ( MixerRingFrames - 1 ) );
+		XMVECTOR	mix		= XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &block[i * MixerChannelCount] ) );
+
+		XMStoreShortN4( reinterpret_cast<XMSHORTN4*>( &ring[index * MixerChannelCount] ), XMVectorClamp( mix, minimum, maximum ) );
+	}
+
+	writeFrame += frameCount;
+}//MixBlock()
+
+void Mixer::Impl::Drain() {
+	//Without an output the mix is thrown away like with the null output
+	if ( !output ) {
+		readFrame = writeFrame;
+		return;
+	}
+
+	while ( readFrame < writeFrame ) {
+		auto writable = output->GetWritableFrames();
+
+		if ( writable == 0 ) {
+			break;
+		}
+
+		auto index	= static_cast<std::uint32_t>( readFrame & ( MixerRingFrames - 1 ) );
+		auto frames	= static_cast<std::uint32_t>( std::min<std::uint64_t>( writeFrame - readFrame, MixerRingFrames - index ) );
+		frames		= std::min<std::uint32_t>( frames, writable );
+
+		output->Write( &ring[index * MixerChannelCount], frames );
+		readFrame += frames;
+	}
+}//Drain()
+
+Mixer::Mixer() :
+	pImpl( new Impl() ) {
+}//Ctor()
+
+Mixer::~Mixer() {
+	if ( pImpl && pImpl->output ) {
+		pImpl->output->Close();
+	}
+}//Dtor()
+
+UTILITY_CLASS_PIMPL_IMPL( Mixer );
+
+bool Mixer::SetOutput( std::unique_ptr<IAudioOutput> output ) {
+	if ( pImpl->output ) {
+		pImpl->output->Close();
+	}
+
+	pImpl->output = std::move( output );
+
+	if ( pImpl->output && !pImpl->output->Open( MixerSampleRate, MixerChannelCount ) ) {
+		pImpl->output = nullptr;
+		return false;
+	}
+
+	return true;
+}//SetOutput()
+
+IAudioOutput* Mixer::GetOutput() const {
+	return pImpl->output.get();
+}//GetOutput()
+
+bool Mixer::Play( const PcmBuffer *pcm, float volume, float pan, bool canSteal ) {
+	if ( !pcm || pcm->FrameCount == 0 || pcm->SampleRate != MixerSampleRate ) {
+		return false;
+	}
+
+	if ( pcm->ChannelCount != 1 && pcm->ChannelCount != 2 ) {
+		return false;
+	}
+
+	MixerVoice *target = nullptr;
+	MixerVoice *oldest = &pImpl->voices[0];
+
+	for ( auto &voice : pImpl->voices ) {
+		if ( !voice.Pcm ) {
+			target = &voice;
+			break;
+		}
+
+		if ( voice.PlayIndex < oldest->PlayIndex ) {
+			oldest = &voice;
+		}
+	}
+
+	if ( !target ) {
+		if ( !canSteal ) {
+			++pImpl->droppedCount;
+			return false;
+		}
+
+		target = oldest;
+		++pImpl->stealCount;
+	}
+
+	//Balance law, the centre plays both sides at full volume
+	pan = std::max<float>( -1.0f, std::min<float>( pan, 1.0f ) );
+
+	target->Pcm			= pcm;
+	target->Position	= 0;
+	target->Gain[0]		= volume * std::min<float>( 1.0f, 1.0f - pan );
+	target->Gain[1]		= volume * std::min<float>( 1.0f, 1.0f + pan );
+	target->PlayIndex	= ++pImpl->playCount;
+	return true;
+}//Play()
+
+void Mixer::StopAll() {
+	for ( auto &voice : pImpl->voices ) {
+		voice.Pcm = nullptr;
+	}
+}//StopAll()
+
+std::uint32_t Mixer::Render( std::uint32_t frameCount ) {
+	frameCount = ( frameCount + 1 ) & ~1U;
+
+	std::uint32_t mixed = 0;
+
+	while ( mixed < frameCount ) {
+		//NOTE: Outputs may take an odd number of frames, so the room is rounded down to
+		//		whole pairs to keep writeFrame even. The odd frame is used after the next drain.
+		auto freeFrames = ( MixerRingFrames - static_cast<std::uint32_t>( pImpl->writeFrame - pImpl->readFrame ) ) & ~1U;
+
+		//The ring is full, make room or stop if the output does not take anything
+		if ( freeFrames == 0 ) {
+			auto readFrame = pImpl->readFrame;
+			pImpl->Drain();
+
+			if ( pImpl->readFrame == readFrame ) {
+				break;
+			}
+
+			continue;
+		}
+
+		auto frames = std::min<std::uint32_t>( std::min<std::uint32_t>( frameCount - mixed, MixerBlockFrames ), freeFrames );
+		auto start	= std::chrono::high_resolution_clock::now();
+
+		pImpl->MixBlock( frames );
+
+		pImpl->mixTime += std::chrono::duration<double>( std::chrono::high_resolution_clock::now() - start ).count();
+		mixed += frames;
+	}
+
+	pImpl->mixedFrames += mixed;
+	pImpl->Drain();
+
+#if _DEBUG
+	if ( pImpl->mixedFrames - pImpl->reportFrames >= static_cast<std::uint64_t>( MixerReportInterval ) * MixerSampleRate / 1000 ) {
+		pImpl->reportFrames = pImpl->mixedFrames;
+
+		Utility::WriteDebugMessage(
+			L"Mixer: %f us per mixed ms (budget %f us), %u voices\n",
+			GetMixCost(),
+			MixerBudgetPerMillisecond,
+			GetActiveVoiceCount()
+			);
+	}
+#endif
+
+	return mixed;
+}//Render()
+
+void Mixer::Advance( float elapsedTime ) {
+	pImpl->pendingFrames += elapsedTime * MixerSampleRate;
+
+	if ( pImpl->pendingFrames >= 1.0f ) {
+		pImpl->pendingFrames -= static_cast<float>( Render( static_cast<std::uint32_t>( pImpl->pendingFrames ) ) );
+	}
+
+	//Do not build up a backlog while the output is not taking anything
+	pImpl->pendingFrames = std::min<float>( pImpl->pendingFrames, static_cast<float>( MixerRingFrames ) );
+}//Advance()
+
+std::uint32_t Mixer::GetActiveVoiceCount() const {
+	std::uint32_t count = 0;
+
+	for ( const auto &voice : pImpl->voices ) {
+		if ( voice.Pcm ) {
+			++count;
+		}
+	}
+
+	return count;
+}//GetActiveVoiceCount()
+
+std::uint64_t Mixer::GetMixedFrames() const {
+	return pImpl->mixedFrames;
+}//GetMixedFrames()
+
+std::uint64_t Mixer::GetStealCount() const {
+	return pImpl->stealCount;
+}//GetStealCount()
+
+std::uint64_t Mixer::GetDroppedCount() const {
+	return pImpl->droppedCount;
+}//GetDroppedCount()
+
+float Mixer::GetMixCost() const {
+	if ( pImpl->mixedFrames == 0 ) {
+		return 0.0f;
+	}
+
+	double milliseconds = static_cast<double>( pImpl->mixedFrames ) * 1000.0 / MixerSampleRate;
+	return static_cast<float>( pImpl->mixTime * 1000000.0 / milliseconds );
+}//GetMixCost()
+
+bool Mixer::IsOverBudget() const {
+	return GetMixCost() > MixerBudgetPerMillisecond;
+}//IsOverBudget()
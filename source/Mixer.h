@@ -0,0 +1,96 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "IAudioOutput.h"
+
+namespace WinGame {
+	namespace Audio {
+		const std::uint32_t	MixerSampleRate				= 44100U;
+		const std::uint32_t	MixerChannelCount			= 2U;
+		const std::size_t	MixerVoiceCount				= 64U;
+		const std::uint32_t	MixerBlockFrames			= 512U;
+		const std::uint32_t	MixerRingFrames				= 8192U;		//Power of two
+		const float			MixerBudgetPerMillisecond	= 50.0f;		//Microseconds of CPU time, 5%
+		const std::uint32_t	MixerReportInterval			= 10000U;		//Mixed milliseconds
+
+		//NOTE: Decoded 16 bit PCM, mono or stereo and interleaved. Samples carries one frame
+		//		of silence after FrameCount frames, the mixer reads frames in pairs and may
+		//		touch it when a sound ends on an odd frame.
+		struct PcmBuffer {
+			std::vector<std::int16_t>	Samples;
+			std::uint32_t				FrameCount;
+			std::uint32_t				ChannelCount;
+			std::uint32_t				SampleRate;
+		};//PcmBuffer struct
+
+		//Reads a 16 bit PCM .wav file, returns false if it is missing or in any other format
+		bool LoadWaveFile( const std::string &filename, PcmBuffer &pcm );
+
+		//NOTE: Software mixer that does not depend on XAudio2, so sounds can be played where
+		//		there is no audio device at all. Voices are mixed two frames at a time with
+		//		DirectXMath (gain and pan as one multiply add, then clamp) into float blocks,
+		//		converted to 16 bit stereo and put into a ring buffer that the output drains.
+		//		Buffers have to be at MixerSampleRate, there is no resampling. The time spent
+		//		mixing is measured and compared against MixerBudgetPerMillisecond.
+		class Mixer {
+		public:
+			explicit Mixer();
+			virtual ~Mixer();
+			UTILITY_CLASS_MOVE( Mixer );
+
+			//Takes ownership of the output and opens it, returns false if that failed
+			bool SetOutput( std::unique_ptr<IAudioOutput> output );
+			IAudioOutput* GetOutput() const;
+
+			//Pan goes from -1 (left) to 1 (right). With every voice busy the oldest one is
+			//stolen if allowed, otherwise the play is dropped and false is returned.
+			bool Play( const PcmBuffer *pcm, float volume = 1.0f, float pan = 0.0f, bool canSteal = true );
+			void StopAll();
+
+			//Mixes up to frameCount frames and hands whatever the output has room for over
+			//to it, returns the number of frames mixed. Frames are mixed in pairs, so an odd
+			//count is rounded up and one frame more is returned.
+			std::uint32_t Render( std::uint32_t frameCount );
+
+			//Mixes the frames that fit into elapsedTime, keeping the fraction for next time
+			void Advance( float elapsedTime );
+
+			std::uint32_t GetActiveVoiceCount() const;
+			std::uint64_t GetMixedFrames() const;
+			std::uint64_t GetStealCount() const;
+			std::uint64_t GetDroppedCount() const;
+
+			//Microseconds of CPU time spent per millisecond of audio mixed so far
+			float	GetMixCost() const;
+			bool	IsOverBudget() const;
+
+		private:
+			UTILITY_CLASS_COPY( Mixer );
+			UTILITY_CLASS_PIMPL();
+
+		};//Mixer class
+
+	}//Audio namespace
+}//WinGame namespace
@@ -29,20 +29,66 @@ using namespace WinGame;
 using namespace WinGame::Audio;
 using namespace Microsoft::WRL;
 
+//NOTE: A cache file is this header, the WAVEFORMATEX of the decoded stream and then the
+//		PCM data up to the end of the file. The size of the source file is kept to notice
+//		an updated asset.
+struct MusicCacheHeader {
+	std::uint32_t	Magic;
+	std::uint32_t	Version;
+	std::uint64_t	SourceSize;
+	std::uint32_t	FormatSize;
+};//MusicCacheHeader struct
+
+const std::uint32_t MusicCacheMagic		= 0x4D435042;	//"BPCM"
+const std::uint32_t MusicCacheVersion	= 1U;
+
 Music::Music() :
 	isInitialized( false ),
 	isPlaying( false ),
-	currentBuffer( 0 ) {
+	sourceVoice( nullptr ),
+	submittedCount( 0 ),
+	decodeEvent( nullptr ),
+	sampleData( nullptr ),
+	sampleSize( 0 ),
+	sampleOffset( 0 ),
+	cacheDataOffset( 0 ) {
+
+	decodedCount.store( 0 );
+	releasedCount.store( 0 );
+	isDecoding.store( false );
 }//Ctor()
 
 Music::~Music() {
 	if ( isInitialized ) {
 		Stop();
+
+		//The audio thread may still be streaming into the voice
+		thread->Synchronize();
 		sourceVoice->DestroyVoice();
 
 		isInitialized	= false;
 		sourceVoice		= nullptr;
 	}
+
+	if ( decoder.joinable() ) {
+		isDecoding.store( false );
+		SetEvent( decodeEvent );
+		decoder.join();
+	}
+
+	if ( decodeEvent ) {
+		CloseHandle( decodeEvent );
+	}
+
+	if ( sampleBuffer ) {
+		sampleBuffer->Unlock();
+	}
+
+	//A cache that was not written completely is of no use
+	if ( cacheOutput.is_open() ) {
+		cacheOutput.close();
+		_wremove( ( cacheFilename + L".tmp" ).c_str() );
+	}
 }//Dtor()
 
 bool Music::IsInitialized() const {
@@ -58,13 +104,7 @@ void Music::Play( float volume ) {
 		return;
 	}
 
-	sourceVoice->SetVolume( volume );
-
-	Utility::ThrowIfFailed(
-		sourceVoice->Start()
-		);
-
-	isPlaying = true;
+	isPlaying = thread->PlayMusic( this, volume );
 }//Play()
 
 void Music::Stop() {
@@ -72,6 +112,22 @@ void Music::Stop() {
 		return;
 	}
 
+	thread->StopMusic( this );
+	isPlaying = false;
+}//Stop()
+
+void Music::Start( float volume ) {
+	sourceVoice->SetVolume( volume );
+
+	//Queue what was decoded ahead before starting so playback does not begin with a gap
+	Stream();
+
+	Utility::ThrowIfFailed(
+		sourceVoice->Start()
+		);
+}//Start()
+
+void Music::Halt() {
 	Utility::ThrowIfFailed(
 		sourceVoice->Stop()
 		);
@@ -79,96 +135,216 @@ void Music::Stop() {
 	Utility::ThrowIfFailed(
 		sourceVoice->FlushSourceBuffers()
 		);
+}//Halt()
 
-	isPlaying = false;
-}//Stop()
+void Music::Stream() {
+	//Buffers the voice has finished with go back to the decoder
+	XAUDIO2_VOICE_STATE state;
+	sourceVoice->GetState( &state, XAUDIO2_VOICE_NOSAMPLESPLAYED );
 
-void Music::Update() {
-	if ( !isInitialized || !isPlaying ) {
-		return;
-	}
+	std::uint32_t released = submittedCount - state.BuffersQueued;
 
-	//Find current state of the playing buffers
-	XAUDIO2_VOICE_STATE state;
-	sourceVoice->GetState( &state );
+	if ( released != releasedCount.load( std::memory_order_relaxed ) ) {
+		releasedCount.store( released, std::memory_order_release );
+		SetEvent( decodeEvent );
+	}
 
-	//Have any of the buffers completed
-	while ( state.BuffersQueued < MaximumBufferCount ) {
-		//Retrive the next buffer to stream from MF Music streamer
-		data[currentBuffer] = GetNextBuffer();
+	//Queue everything the decoder has filled since
+	std::uint32_t decoded = decodedCount.load( std::memory_order_acquire );
 
-		if ( data[currentBuffer].size() == 0 ) {
-			//Audio file has been fully read, restart the loop
-			Restart();
-			break;
-		}
+	while ( submittedCount != decoded ) {
+		auto &ringBuffer = buffers[submittedCount % MusicRingBufferCount];
 
-		//Submit the new Buffer
 		XAUDIO2_BUFFER buffer = {0};
-		buffer.AudioBytes = static_cast<UINT32>( data[currentBuffer].size() );
-		buffer.pAudioData = &data[currentBuffer][0];
+		buffer.AudioBytes = ringBuffer.Size;
+		buffer.pAudioData = &ringBuffer.Data[0];
 
 		Utility::ThrowIfFailed(
 			sourceVoice->SubmitSourceBuffer( &buffer )
 			);
 
-		//Advance the Buffer Index
-		currentBuffer = ++currentBuffer % MaximumBufferCount;
+		++submittedCount;
+	}
+}//Stream()
+
+void Music::OpenCache( std::uint64_t sourceSize, std::vector<byte> &format ) {
+	cacheInput.open( cacheFilename.c_str(), std::ios::binary );
 
-		//Get the Updated state
-		sourceVoice->GetState( &state );
+	if ( !cacheInput.is_open() ) {
+		return;
 	}
-}//Update()
 
-std::vector<byte> Music::GetNextBuffer() {
-	std::vector<byte>	resultData;
-	ComPtr<IMFSample>	sample;
-	DWORD				flags;
+	MusicCacheHeader header;
+	cacheInput.read( reinterpret_cast<char*>( &header ), sizeof( header ) );
 
-	Utility::ThrowIfFailed(
-		reader->ReadSample(
-			static_cast<DWORD>( MF_SOURCE_READER_FIRST_AUDIO_STREAM ),
-			0,
-			nullptr,
-			&flags,
-			nullptr,
-			&sample
-			)
-		);
+	bool isValid =	cacheInput.good() &&
+					header.Magic == MusicCacheMagic &&
+					header.Version == MusicCacheVersion &&
+					header.SourceSize == sourceSize &&
+					header.FormatSize >= sizeof( WAVEFORMATEX );
 
-	//End of Stream
-	if ( flags & MF_SOURCE_READERF_ENDOFSTREAM ) {
-		return resultData;
+	if ( isValid ) {
+		format.resize( header.FormatSize );
+		cacheInput.read( reinterpret_cast<char*>( &format[0] ), header.FormatSize );
+		isValid = cacheInput.good();
 	}
 
-	if ( !sample ) {
-		throw ref new Platform::FailureException();
+	if ( !isValid ) {
+		format.clear();
+		cacheInput.close();
+		return;
 	}
 
-	ComPtr<IMFMediaBuffer> mediaBuffer;
-	Utility::ThrowIfFailed(
-		sample->ConvertToContiguousBuffer( &mediaBuffer )
-		);
+	cacheDataOffset = cacheInput.tellg();
+}//OpenCache()
 
-	std::uint8_t	*audioData			= nullptr;
-	std::uint32_t	sampleBufferLength	= 0;
+void Music::CreateCache( std::uint64_t sourceSize, const std::vector<byte> &format ) {
+	//Written under a temporary name, FinishCache() renames it once the first pass is complete
+	cacheOutput.open( ( cacheFilename + L".tmp" ).c_str(), std::ios::binary | std::ios::trunc );
 
-	Utility::ThrowIfFailed(
-		mediaBuffer->Lock( &audioData, nullptr, reinterpret_cast<DWORD*>( &sampleBufferLength ) )
-		);
+	if ( !cacheOutput.is_open() ) {
+		return;
+	}
 
-	//Prepare and return the new Buffer Data
-	resultData.resize( sampleBufferLength );
-	CopyMemory( &resultData[0], audioData, sampleBufferLength );
+	MusicCacheHeader header = { MusicCacheMagic, MusicCacheVersion, sourceSize, static_cast<std::uint32_t>( format.size() ) };
 
-	Utility::ThrowIfFailed(
-		mediaBuffer->Unlock()
-		);
+	cacheOutput.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+	cacheOutput.write( reinterpret_cast<const char*>( &format[0] ), format.size() );
+}//CreateCache()
+
+void Music::StartDecoder( std::uint32_t blockAlign ) {
+	//Whole frames only, a frame must never be split between two buffers
+	std::uint32_t capacity = std::max<std::uint32_t>( MusicBufferBytes / blockAlign, 1 ) * blockAlign;
+
+	for ( auto &buffer : buffers ) {
+		buffer.Data.resize( capacity );
+		buffer.Size = 0;
+	}
+
+	decodeEvent = CreateEventEx( nullptr, nullptr, 0, EVENT_ALL_ACCESS );
+
+	if ( !decodeEvent ) {
+		Utility::ThrowIfFailed( HRESULT_FROM_WIN32( GetLastError() ) );
+	}
+
+	isDecoding.store( true );
+
+	decoder = std::thread( [this]() {
+		Decode();
+	} );
+}//StartDecoder()
+
+void Music::Decode() {
+	try {
+		while ( isDecoding.load() ) {
+			std::uint32_t decoded = decodedCount.load( std::memory_order_relaxed );
+
+			//Wait for the voice to hand a buffer back
+			if ( decoded - releasedCount.load( std::memory_order_acquire ) == MusicRingBufferCount ) {
+				WaitForSingleObjectEx( decodeEvent, INFINITE, FALSE );
+				continue;
+			}
+
+			auto &buffer	= buffers[decoded % MusicRingBufferCount];
+			bool restarted	= false;
+			buffer.Size		= 0;
+
+			while ( buffer.Size < buffer.Data.size() && isDecoding.load() ) {
+				auto count = Read( &buffer.Data[buffer.Size], static_cast<std::uint32_t>( buffer.Data.size() ) - buffer.Size );
+
+				if ( count == 0 ) {
+					//Nothing at all right after a restart, the stream is empty
+					if ( restarted ) {
+						isDecoding.store( false );
+						break;
+					}
+
+					//End of the stream, the start follows right in the same buffer
+					FinishCache();
+					Restart();
+				}
+
+				restarted	= count == 0;
+				buffer.Size	+= count;
+			}
+
+			if ( buffer.Size > 0 ) {
+				decodedCount.store( decoded + 1, std::memory_order_release );
+			}
+		}
+	} catch ( Platform::Exception^ ) {
+		//The music stops once the decoded buffers have played
+		isDecoding.store( false );
+	}
+}//Decode()
+
+std::uint32_t Music::Read( byte *target, std::uint32_t size ) {
+	if ( cacheInput.is_open() ) {
+		cacheInput.read( reinterpret_cast<char*>( target ), size );
+		return static_cast<std::uint32_t>( cacheInput.gcount() );
+	}
+
+	//Take the next sample from the reader once the current one is used up
+	while ( sampleOffset == sampleSize ) {
+		if ( sampleBuffer ) {
+			sampleBuffer->Unlock();
+			sampleBuffer = nullptr;
+		}
+
+		ComPtr<IMFSample>	sample;
+		DWORD				flags = 0;
+
+		Utility::ThrowIfFailed(
+			reader->ReadSample(
+				static_cast<DWORD>( MF_SOURCE_READER_FIRST_AUDIO_STREAM ),
+				0,
+				nullptr,
+				&flags,
+				nullptr,
+				&sample
+				)
+			);
+
+		if ( flags & MF_SOURCE_READERF_ENDOFSTREAM ) {
+			return 0;
+		}
+
+		if ( !sample ) {
+			continue;
+		}
+
+		Utility::ThrowIfFailed(
+			sample->ConvertToContiguousBuffer( &sampleBuffer )
+			);
+
+		DWORD length = 0;
+
+		Utility::ThrowIfFailed(
+			sampleBuffer->Lock( &sampleData, nullptr, &length )
+			);
+
+		sampleSize		= length;
+		sampleOffset	= 0;
+	}
+
+	std::uint32_t count = std::min<std::uint32_t>( size, sampleSize - sampleOffset );
+	CopyMemory( target, sampleData + sampleOffset, count );
 
-	return resultData;
-}//GetNextBuffer()
+	if ( cacheOutput.is_open() ) {
+		cacheOutput.write( reinterpret_cast<const char*>( sampleData + sampleOffset ), count );
+	}
+
+	sampleOffset += count;
+	return count;
+}//Read()
 
 void Music::Restart() {
+	if ( cacheInput.is_open() ) {
+		cacheInput.clear();
+		cacheInput.seekg( cacheDataOffset );
+		return;
+	}
+
 	PROPVARIANT var = {0};
 	var.vt			= VT_I8;
 
@@ -176,3 +352,19 @@ void Music::Restart() {
 		reader->SetCurrentPosition( GUID_NULL, var )
 		);
 }//Restart()
+
+void Music::FinishCache() {
+	if ( !cacheOutput.is_open() ) {
+		return;
+	}
+
+	cacheOutput.close();
+
+	//Only a complete cache gets its real name
+	auto temporary = cacheFilename + L".tmp";
+	_wremove( cacheFilename.c_str() );
+
+	if ( cacheOutput.fail() || _wrename( temporary.c_str(), cacheFilename.c_str() ) != 0 ) {
+		_wremove( temporary.c_str() );
+	}
+}//FinishCache()
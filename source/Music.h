@@ -23,12 +23,26 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+#include "AudioThread.h"
+#include <fstream>
+
 namespace WinGame {
 	namespace Audio {
-		const std::size_t MaximumBufferCount = 3U;
+		const std::uint32_t	MusicRingBufferCount	= 8U;
+		const std::uint32_t	MusicBufferBytes		= 32768U;
 
+		//NOTE: Play() and Stop() queue a command for the audio thread, which submits decoded
+		//		buffers while the music is playing. IsPlaying() reflects the last call made on
+		//		the game thread.
+		//
+		//		Decoding runs ahead on a worker of its own into a ring of buffers allocated once.
+		//		The worker only fills a buffer after XAudio2 is done with it, and at the end of
+		//		the stream it seeks back and keeps filling the same buffer, so the loop point
+		//		never waits for a seek and has no gap. If a cache file is given the first full
+		//		pass is written to it as PCM, later runs read that instead of decoding again.
 		class Music {
 			friend class AudioManager;
+			friend class AudioThread;
 
 		public:
 			explicit Music();
@@ -38,21 +52,60 @@ namespace WinGame {
 			bool IsPlaying() const;
 
 			void Play( float volume = 1.0f );
-			void Update();
 			void Stop();
 
 		private:
-			std::vector<byte> GetNextBuffer();
+			struct Buffer {
+				std::vector<byte>	Data;
+				std::uint32_t		Size;
+			};//Buffer struct
+
+			//Audio thread
+			void Start( float volume );
+			void Stream();
+			void Halt();
+
+			//Sets up reading from the cache file, format stays empty if it is missing or stale
+			void OpenCache( std::uint64_t sourceSize, std::vector<byte> &format );
+			void CreateCache( std::uint64_t sourceSize, const std::vector<byte> &format );
+
+			//Decoder thread
+			void StartDecoder( std::uint32_t blockAlign );
+			void Decode();
+			std::uint32_t Read( byte *target, std::uint32_t size );
 			void Restart();
+			void FinishCache();
 
 			bool isInitialized;
 			bool isPlaying;
 
+			std::shared_ptr<AudioThread>			thread;
 			Microsoft::WRL::ComPtr<IMFSourceReader> reader;
 			IXAudio2SourceVoice						*sourceVoice;
-			std::vector<byte>						data[MaximumBufferCount];
-			std::size_t								currentBuffer;
-			
+
+			//Ring, buffers below releasedCount are free again, up to decodedCount they are
+			//filled and up to submittedCount queued on the voice
+			Buffer						buffers[MusicRingBufferCount];
+			std::atomic<std::uint32_t>	decodedCount;
+			std::atomic<std::uint32_t>	releasedCount;
+			std::uint32_t				submittedCount;		//Audio thread only
+
+			std::thread			decoder;
+			HANDLE				decodeEvent;
+			std::atomic<bool>	isDecoding;
+
+			//Sample being copied into the ring, locked until it is used up
+			Microsoft::WRL::ComPtr<IMFMediaBuffer>	sampleBuffer;
+			byte									*sampleData;
+			std::uint32_t							sampleSize;
+			std::uint32_t							sampleOffset;
+
+			//PCM cache, read from cacheInput or written to cacheOutput while decoding the first pass
+			std::ifstream	cacheInput;
+			std::streamoff	cacheDataOffset;
+			std::ofstream	cacheOutput;
+			std::wstring	cacheFilename;
+
 		};//Music class
 
 	}//Audio namespace
@@ -0,0 +1,116 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace BreakIt {
+	namespace Objects {
+		//NOTE: Free list of objects of one type that left the game. Owners hand dead objects
+		//		back through Collect() and take them out again with Acquire() instead of going
+		//		through new and delete, recycled objects keep their texture reference as well.
+		//		Objects never move while they are alive, so a pointer to one stays valid until
+		//		it is collected.
+		template<typename T>
+		class ObjectPool {
+		public:
+			ObjectPool() :
+				freeObjects( 0 ) {
+			}//Ctor()
+
+			~ObjectPool() {
+			}//Dtor()
+
+			//Returns nullptr if the pool is empty, the caller constructs a new object then
+			std::unique_ptr<T> Acquire() {
+				if ( freeObjects.empty() ) {
+					return nullptr;
+				}
+
+				auto object = std::move( freeObjects.back() );
+				freeObjects.pop_back();
+				return object;
+			}//Acquire()
+
+			void Release( std::unique_ptr<T> object ) {
+				if ( object ) {
+					freeObjects.push_back( std::move( object ) );
+				}
+			}//Release()
+
+			//Moves every object the predicate marks as dead from objects into the pool,
+			//the order of the remaining objects is kept like with erase( remove_if )
+			template<typename Predicate>
+			void Collect( std::vector<std::unique_ptr<T>> &objects, Predicate isDead ) {
+				auto alive = std::begin( objects );
+
+				for ( auto it = std::begin( objects ); it != std::end( objects ); ++it ) {
+					if ( isDead( *it ) ) {
+						Release( std::move( *it ) );
+					} else {
+						if ( alive != it ) {
+							*alive = std::move( *it );
+						}
+
+						++alive;
+					}
+				}
+
+				objects.erase( alive, std::end( objects ) );
+			}//Collect()
+
+			void CollectAll( std::vector<std::unique_ptr<T>> &objects ) {
+				for ( auto &object : objects ) {
+					Release( std::move( object ) );
+				}
+
+				objects.clear();
+			}//CollectAll()
+
+			//Fills the pool up to count objects made by create(), so the first spawns of a
+			//level do not allocate either
+			template<typename Factory>
+			void Reserve( std::uint32_t count, Factory create ) {
+				freeObjects.reserve( count );
+
+				while ( freeObjects.size() < count ) {
+					freeObjects.push_back( create() );
+				}
+			}//Reserve()
+
+			void Clear() {
+				freeObjects.clear();
+			}//Clear()
+
+			std::uint32_t GetFreeCount() const {
+				return static_cast<std::uint32_t>( freeObjects.size() );
+			}//GetFreeCount()
+
+		private:
+			ObjectPool( const ObjectPool& );
+			ObjectPool& operator=( const ObjectPool& );
+
+			std::vector<std::unique_ptr<T>> freeObjects;
+		};//ObjectPool class
+
+	}//Objects namespace
+}//BreakIt namespace
@@ -24,7 +24,6 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "pch.h"
 #include "Player.h"
 #include "Globals.h"
-#include "ItemManager.h"
 #include "BrickManager.h"
 
 using namespace BreakIt;
@@ -34,16 +33,17 @@ using namespace DirectX;
 Player::Player( float x, float y, const std::shared_ptr<WinGame::Graphics::Texture2D> &texture ) :
 	DrawableObject( x, y, PlayerTextureWidth, PlayerTextureHeight, texture ),
 	Health( PlayerStartHealth ),
+	TempHealth( 0 ),
 	Points( 0 ),
+	TempPoints( 0 ),
 	growSize( 2 ),
 	leftOffset( 130 ),
 	deltaX( 0.0f ),
-	laserActivated( false ),
 	laserTime( false ),
+	laserActivated( false ),
 	laserCount( 0 ),
 	laserShots( 0 ),
-	TempPoints( 0 ),
-	TempHealth( 0 ) {
+	laserPool() {
 
 	HitBoxOffset = XMFLOAT2( 0.0f, 0.0f );
 	ResetGrowth();
@@ -67,6 +67,11 @@ Player::Player( float x, float y, const std::shared_ptr<WinGame::Graphics::Textu
 	canon->SourceRect.bottom	= canon->SourceRect.top + Utility::ftoi( 16 );
 
 	XMStoreFloat4( &RenderColor, Colors::White );
+
+	laserShots.reserve( LaserPoolSize );
+	laserPool.Reserve( LaserPoolSize, [&texture]() {
+		return std::make_unique<Laser>( 0.0f, 0.0f, texture );
+	} );
 }//Ctor()
 
 Player::~Player() {
@@ -85,16 +90,27 @@ void Player::ResetLaser() {
 	laserTime		= 0.0f;
 	laserCount		= 0;
 
-	laserShots.clear();
+	laserPool.CollectAll( laserShots );
 }//ResetLaser()
 
+std::unique_ptr<Laser> Player::SpawnLaser( float x, float y ) {
+	auto shot = laserPool.Acquire();
+
+	if ( shot ) {
+		shot->Reset( x, y );
+		return shot;
+	}
+
+	return std::make_unique<Laser>( x, y, Texture );
+}//SpawnLaser()
+
 void Player::ActivateLaser() {
 	laserActivated	= true;
 	laserTime		= 0.0f;
 	laserCount		= 0;
 }//ActivateLaser()
 
-void Player::Update( float elapsedTime, float totalTime, SoundManager *sounds, BrickManager *bricks, ItemManager *items ) {
+void Player::Update( float elapsedTime, float totalTime, ISoundObserver *sounds, BrickManager *bricks, CollisionQueue *events ) {
 	if ( laserActivated ) {
 		laserTime += elapsedTime;
 
@@ -106,16 +122,15 @@ void Player::Update( float elapsedTime, float totalTime, SoundManager *sounds, B
 			float posX = Position.x;
 
 			for ( decltype( growSize ) i = 0; i <= growSize; ++i ) {
-				sounds->PlaySound( SOUND_FILE::LASER_SHOT );
+				if ( sounds ) {
+					sounds->PlaySound( SOUND_FILE::LASER_SHOT );
+				}
 				laserShots.push_back(
-				std::move(
-					std::make_unique<Laser>(
+					SpawnLaser(
 						posX + PlayerWidth * 0.5f - 16.0f,
-						Position.y - 10.0f,
-						Texture
+						Position.y - 10.0f
 						)
-					)
-				);
+					);
 
 				posX += Size.x - 2.0f;
 			}
@@ -138,22 +153,70 @@ void Player::Update( float elapsedTime, float totalTime, SoundManager *sounds, B
 				}
 
 				if ( shot->IsVisible ) {
-					bricks->CheckCollision( shot.get(), this, sounds, items );
+					bricks->CheckCollision( shot.get(), events );
 				}
 			}
 		}
 
-		laserShots.erase(
-			std::remove_if(
-				std::begin( laserShots ),
-				std::end( laserShots ),
-				Laser::IsRemoveReady
-				),
-			std::end( laserShots )
-			);
+		laserPool.Collect( laserShots, Laser::IsRemoveReady );
 	}
 }//Update()
 
+void Player::StorePreviousPositions() {
+	StorePreviousPosition();
+
+	for ( auto &shot : laserShots ) {
+		shot->StorePreviousPosition();
+	}
+}//StorePreviousPositions()
+
+void Player::SaveState( SnapshotWriter &writer ) const {
+	writer.Write( Position );
+	writer.Write( HitBoxSize );
+	writer.Write( Health );
+	writer.Write( TempHealth );
+	writer.Write( Points );
+	writer.Write( TempPoints );
+	writer.Write( growSize );
+	writer.Write( leftOffset );
+	writer.Write( deltaX );
+	writer.Write( laserTime );
+	writer.Write( laserActivated );
+	writer.Write( laserCount );
+	writer.Write( static_cast<std::uint32_t>( laserShots.size() ) );
+
+	for ( const auto &shot : laserShots ) {
+		shot->SaveState( writer );
+	}
+}//SaveState()
+
+void Player::LoadState( SnapshotReader &reader ) {
+	std::uint32_t shots = 0;
+
+	reader.Read( Position );
+	reader.Read( HitBoxSize );
+	reader.Read( Health );
+	reader.Read( TempHealth );
+	reader.Read( Points );
+	reader.Read( TempPoints );
+	reader.Read( growSize );
+	reader.Read( leftOffset );
+	reader.Read( deltaX );
+	reader.Read( laserTime );
+	reader.Read( laserActivated );
+	reader.Read( laserCount );
+	reader.Read( shots );
+
+	laserPool.CollectAll( laserShots );
+	for ( std::uint32_t i = 0; i < shots && reader.IsValid(); ++i ) {
+		auto shot = SpawnLaser( 0.0f, 0.0f );
+		shot->LoadState( reader );
+		laserShots.push_back( std::move( shot ) );
+	}
+
+	StorePreviousPosition();
+}//LoadState()
+
 void Player::Move( FXMVECTOR delta ) {
 	if ( XMVector2NotEqual( delta, XMVectorZero() ) ) {
 		deltaX += XMVectorGetX( XMVectorAbs( delta ) );
@@ -226,6 +289,7 @@ void Player::ResetGrowth() {
 	HitBoxSize		= XMFLOAT2( PlayerWidth * static_cast<float>( growSize + 1 ) - offset , PlayerHeight );
 }//ResetGrowth()
 
+#ifndef BREAKIT_HEADLESS
 void Player::Draw( DirectX::SpriteBatch *batch ) {
 	if ( !Texture || !Texture->IsInitialized() || !IsVisible ) {
 		return;
@@ -242,7 +306,8 @@ void Player::Draw( DirectX::SpriteBatch *batch ) {
 	src.bottom	= src.top + Utility::ftoi( PlayerTextureHeight );
 
 	auto	middle	= growSize / 2;
-	float	posX	= Position.x;
+	auto	pos		= GetRenderPosition();
+	float	posX	= pos.x;
 
 	for ( decltype( growSize ) i = 0; i <= growSize; ++i ) {
 		if ( i == middle ) {
@@ -258,12 +323,12 @@ void Player::Draw( DirectX::SpriteBatch *batch ) {
 		}
 
 		dest.left	= Utility::ftoi( posX );
-		dest.top	= Utility::ftoi( Position.y );
+		dest.top	= Utility::ftoi( pos.y );
 		dest.right	= dest.left + Utility::ftoi( Size.x );
 		dest.bottom = dest.top + Utility::ftoi( Size.y );
 		
 		canon->Position.x = posX;
-		canon->Position.y = Position.y;
+		canon->Position.y = pos.y;
 
 		posX += Size.x - 2.0f;
 		
@@ -281,3 +346,4 @@ void Player::Draw( DirectX::SpriteBatch *batch ) {
 		}
 	}
 }//Draw()
+#endif
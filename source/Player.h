@@ -25,21 +25,28 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "DrawableObject.h"
 #include "Laser.h"
-#include "SoundManager.h"
+#include "ISoundObserver.h"
+#include "Snapshot.h"
+#include "ObjectPool.h"
+#include "CollisionQueue.h"
 
 namespace BreakIt {
 	namespace Objects {
 		class BrickManager;
-		class ItemManager;
 
 		class Player : public DrawableObject {
 		public:
 			explicit Player( float x, float y, const std::shared_ptr<WinGame::Graphics::Texture2D> &texture );
 			virtual ~Player();
 
-			void			Update( float elapsedTime, float totalTime, SoundManager *sound, BrickManager *bricks, ItemManager *items );
+			void			Update( float elapsedTime, float totalTime, ISoundObserver *sound, BrickManager *bricks, CollisionQueue *events );
+#ifndef BREAKIT_HEADLESS
 			virtual void	Draw( DirectX::SpriteBatch *batch ) override;
+#endif
 			
+			void StorePreviousPositions();
+			void SaveState( SnapshotWriter &writer ) const;
+			void LoadState( SnapshotReader &reader );
 			void Clamp( DirectX::FXMVECTOR leftBorderMax, DirectX::FXMVECTOR rightBorderMin );
 			void Move( DirectX::FXMVECTOR delta );
 			void Grow();
@@ -67,7 +74,10 @@ namespace BreakIt {
 			int		laserCount;
 
 			std::vector<std::unique_ptr<Laser>> laserShots;
+			ObjectPool<Laser>					laserPool;
 			std::unique_ptr<DrawableObject>		canon;
+
+			std::unique_ptr<Laser> SpawnLaser( float x, float y );
 		};//Player class
 
 	}//Objects namespace
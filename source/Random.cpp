@@ -0,0 +1,228 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "Random.h"
+#include <chrono>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+
+const std::uint32_t RandomJump[4] = { 0x8764000bU, 0xf542d2d3U, 0x6fa035c3U, 0x77f2db5bU };
+
+static std::uint32_t RotateLeft( std::uint32_t value, int shift ) {
+	return ( value << shift ) | ( value >> ( 32 - shift ) );
+}//RotateLeft()
+
+static std::uint64_t SplitMix( std::uint64_t &value ) {
+	auto z = ( value += 0x9e3779b97f4a7c15ULL );
+	z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+	return z ^ ( z >> 31 );
+}//SplitMix()
+
+Random::Random() {
+	Seed( 0, RANDOM_STREAM::ITEM_DROPS );
+}//Ctor()
+
+Random::~Random() {
+}//Dtor()
+
+void Random::Seed( std::uint32_t seed, RANDOM_STREAM stream ) {
+	std::uint64_t value = seed;
+	auto low	= SplitMix( value );
+	auto high	= SplitMix( value );
+
+	state[0] = static_cast<std::uint32_t>( low );
+	state[1] = static_cast<std::uint32_t>( low >> 32 );
+	state[2] = static_cast<std::uint32_t>( high );
+	state[3] = static_cast<std::uint32_t>( high >> 32 );
+
+	//An all zero state would only ever give zeros
+	if ( ( state[0] | state[1] | state[2] | state[3] ) == 0 ) {
+		state[0] = 1;
+	}
+
+	for ( std::uint32_t i = 0; i < static_cast<std::uint32_t>( stream ); ++i ) {
+		Jump();
+	}
+}//Seed()
+
+//NOTE: Same as 2^64 calls to Next()
+void Random::Jump() {
+	std::uint32_t jumped[4] = { 0, 0, 0, 0 };
+
+	for ( int i = 0; i < 4; ++i ) {
+		for ( int bit = 0; bit < 32; ++bit ) {
+			if ( RandomJump[i] & ( 1U << bit ) ) {
+				jumped[0] ^= state[0];
+				jumped[1] ^= state[1];
+				jumped[2] ^= state[2];
+				jumped[3] ^= state[3];
+			}
+
+			Next();
+		}
+	}
+
+	SetState( jumped );
+}//Jump()
+
+std::uint32_t Random::Next() {
+	auto result	= RotateLeft( state[1] * 5, 7 ) * 9;
+	auto t		= state[1] << 9;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = RotateLeft( state[3], 11 );
+
+	return result;
+}//Next()
+
+//Multiply and shift instead of modulo, the bias is below 2^-32 * bound
+std::uint32_t Random::NextBelow( std::uint32_t bound ) {
+	return static_cast<std::uint32_t>( ( static_cast<std::uint64_t>( Next() ) * bound ) >> 32 );
+}//NextBelow()
+
+float Random::NextFloat() {
+	return static_cast<float>( Next() >> 8 ) * ( 1.0f / 16777216.0f );
+}//NextFloat()
+
+void Random::GetState( std::uint32_t target[4] ) const {
+	target[0] = state[0];
+	target[1] = state[1];
+	target[2] = state[2];
+	target[3] = state[3];
+}//GetState()
+
+void Random::SetState( const std::uint32_t source[4] ) {
+	state[0] = source[0];
+	state[1] = source[1];
+	state[2] = source[2];
+	state[3] = source[3];
+}//SetState()
+
+std::uint32_t Random::GetClockSeed() {
+	auto ticks = static_cast<std::uint64_t>( std::chrono::high_resolution_clock::now().time_since_epoch().count() );
+	return static_cast<std::uint32_t>( ticks ^ ( ticks >> 32 ) );
+}//GetClockSeed()
+
+AliasTable::AliasTable() :
+	columns( 0 ) {
+}//Ctor()
+
+AliasTable::~AliasTable() {
+}//Dtor()
+
+void AliasTable::Build( const std::vector<double> &weights ) {
+	auto count	= static_cast<std::uint32_t>( weights.size() );
+	double sum	= 0.0;
+
+	for ( auto weight : weights ) {
+		sum += std::max<double>( weight, 0.0 );
+	}
+
+	columns.resize( count );
+	if ( count == 0 || sum <= 0.0 ) {
+		for ( std::uint32_t i = 0; i < count; ++i ) {
+			columns[i].Threshold	= 0xFFFFFFFFU;
+			columns[i].Alias		= i;
+		}
+		return;
+	}
+
+	//Every column holds 1/count of the probability, split between its own index
+	//and the alias that fills up what is left
+	std::vector<double>			scaled( count );
+	std::vector<std::uint32_t>	small;
+	std::vector<std::uint32_t>	large;
+
+	for ( std::uint32_t i = 0; i < count; ++i ) {
+		scaled[i] = std::max<double>( weights[i], 0.0 ) * count / sum;
+
+		if ( scaled[i] < 1.0 ) {
+			small.push_back( i );
+		} else {
+			large.push_back( i );
+		}
+	}
+
+	while ( !small.empty() && !large.empty() ) {
+		auto less = small.back();
+		auto more = large.back();
+		small.pop_back();
+		large.pop_back();
+
+		columns[less].Threshold	= static_cast<std::uint32_t>( scaled[less] * 4294967296.0 );
+		columns[less].Alias		= more;
+
+		scaled[more] = ( scaled[more] + scaled[less] ) - 1.0;
+
+		if ( scaled[more] < 1.0 ) {
+			small.push_back( more );
+		} else {
+			large.push_back( more );
+		}
+	}
+
+	//Whatever is left is 1.0 up to rounding
+	for ( auto index : large ) {
+		columns[index].Threshold	= 0xFFFFFFFFU;
+		columns[index].Alias		= index;
+	}
+
+	for ( auto index : small ) {
+		columns[index].Threshold	= 0xFFFFFFFFU;
+		columns[index].Alias		= index;
+	}
+}//Build()
+
+std::uint32_t AliasTable::Sample( Random &random ) const {
+	auto index = random.NextBelow( GetCount() );
+	return random.Next() < columns[index].Threshold ? index : columns[index].Alias;
+}//Sample()
+
+std::uint32_t AliasTable::GetCount() const {
+	return static_cast<std::uint32_t>( columns.size() );
+}//GetCount()
+
+double AliasTable::GetProbability( std::uint32_t index ) const {
+	double probability = 0.0;
+
+	for ( std::uint32_t i = 0; i < GetCount(); ++i ) {
+		double own = columns[i].Threshold == 0xFFFFFFFFU ? 1.0 : static_cast<double>( columns[i].Threshold ) / 4294967296.0;
+
+		if ( i == index ) {
+			probability += own;
+		}
+
+		if ( columns[i].Alias == index && columns[i].Alias != i ) {
+			probability += 1.0 - own;
+		}
+	}
+
+	return GetCount() > 0 ? probability / GetCount() : 0.0;
+}//GetProbability()
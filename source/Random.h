@@ -0,0 +1,84 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace BreakIt {
+	namespace Objects {
+		//NOTE: Every subsystem that needs random numbers draws from its own stream. Streams
+		//		of one seed are 2^64 draws apart, so they never overlap and adding draws to one
+		//		subsystem does not change what another one gets.
+		enum class RANDOM_STREAM : std::uint32_t {
+			ITEM_DROPS = 0x00U
+		};//RANDOM_STREAM enum class
+
+		//NOTE: xoshiro128** generator, seeded through splitmix64. The whole state is four
+		//		words, so snapshots store it directly.
+		class Random {
+		public:
+			explicit Random();
+			~Random();
+
+			void Seed( std::uint32_t seed, RANDOM_STREAM stream );
+			void Jump();
+
+			std::uint32_t	Next();
+			std::uint32_t	NextBelow( std::uint32_t bound );
+			float			NextFloat();
+
+			void GetState( std::uint32_t state[4] ) const;
+			void SetState( const std::uint32_t state[4] );
+
+			//A changing seed for runs that do not set their own
+			static std::uint32_t GetClockSeed();
+
+		private:
+			std::uint32_t state[4];
+		};//Random class
+
+		//NOTE: Walker/Vose alias table, samples a weighted index with two draws and one
+		//		comparison no matter how many weights there are. Sample() needs a built
+		//		table with at least one weight.
+		class AliasTable {
+		public:
+			explicit AliasTable();
+			~AliasTable();
+
+			void			Build( const std::vector<double> &weights );
+			std::uint32_t	Sample( Random &random ) const;
+			std::uint32_t	GetCount() const;
+
+			//Probability the table actually gives index, to check it against the weights
+			double GetProbability( std::uint32_t index ) const;
+
+		private:
+			struct Column {
+				std::uint32_t Threshold;
+				std::uint32_t Alias;
+			};//Column struct
+
+			std::vector<Column> columns;
+		};//AliasTable class
+
+	}//Objects namespace
+}//BreakIt namespace
@@ -0,0 +1,210 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "Replay.h"
+#include "GameplayManager.h"
+#include "Globals.h"
+#include "Snapshot.h"
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+using namespace DirectX;
+
+const std::uint32_t ReplayMagic			= 0x50524942; //"BIRP"
+const std::uint16_t ReplayVersion		= 3;
+const std::uint32_t ReplayHeaderSize	= 20;
+const std::uint32_t ReplayTickSize		= 5;
+const std::uint8_t	MaximumTickEvents	= 255;
+
+Replay::Replay() :
+	seed( 0 ),
+	tickTime( 1.0f / DefaultTickRate ),
+	isWidescreen( false ),
+	pendingEvents( 0 ) {
+}//Ctor()
+
+Replay::Replay( std::uint32_t seed, float tickTime, bool widescreen ) :
+	seed( seed ),
+	tickTime( tickTime ),
+	isWidescreen( widescreen ),
+	pendingEvents( 0 ) {
+}//Ctor()
+
+Replay::~Replay() {
+}//Dtor()
+
+void Replay::Reset( std::uint32_t seed, float tickTime, bool widescreen ) {
+	this->seed		= seed;
+	this->tickTime	= tickTime;
+	isWidescreen	= widescreen;
+	pendingEvents	= 0;
+	ticks.clear();
+	events.clear();
+}//Reset()
+
+//NOTE: The count of a tick is stored in one byte, input alone never gets near the limit
+void Replay::AddEvent( REPLAY_EVENT replayEvent ) {
+	if ( pendingEvents < MaximumTickEvents ) {
+		events.push_back( replayEvent );
+		++pendingEvents;
+	}
+}//AddEvent()
+
+void Replay::AddTick( float playerDelta ) {
+	ReplayTick tick;
+	tick.PlayerDelta	= playerDelta;
+	tick.FirstEvent		= static_cast<std::uint32_t>( events.size() ) - pendingEvents;
+	tick.EventCount		= pendingEvents;
+
+	ticks.push_back( tick );
+	pendingEvents = 0;
+}//AddTick()
+
+std::uint32_t Replay::GetSeed() const {
+	return seed;
+}//GetSeed()
+
+float Replay::GetTickTime() const {
+	return tickTime;
+}//GetTickTime()
+
+bool Replay::IsWidescreen() const {
+	return isWidescreen;
+}//IsWidescreen()
+
+std::uint32_t Replay::GetTickCount() const {
+	return static_cast<std::uint32_t>( ticks.size() );
+}//GetTickCount()
+
+const ReplayTick& Replay::GetTick( std::uint32_t index ) const {
+	return ticks[index];
+}//GetTick()
+
+REPLAY_EVENT Replay::GetEvent( const ReplayTick &tick, std::uint8_t index ) const {
+	return events[tick.FirstEvent + index];
+}//GetEvent()
+
+std::vector<std::uint8_t> Replay::Save() const {
+	std::vector<std::uint8_t> data;
+	data.reserve( ReplayHeaderSize + ReplayTickSize * ticks.size() + events.size() );
+
+	SnapshotWriter writer( data );
+	writer.Write( ReplayMagic );
+	writer.Write( ReplayVersion );
+	writer.Write( static_cast<std::uint16_t>( isWidescreen ? 1 : 0 ) );
+	writer.Write( seed );
+	writer.Write( tickTime );
+	writer.Write( GetTickCount() );
+
+	for ( const auto &tick : ticks ) {
+		writer.Write( tick.PlayerDelta );
+		writer.Write( tick.EventCount );
+
+		for ( std::uint8_t i = 0; i < tick.EventCount; ++i ) {
+			writer.Write( GetEvent( tick, i ) );
+		}
+	}
+
+	return data;
+}//Save()
+
+bool Replay::Load( const std::uint8_t *data, std::uint32_t length ) {
+	SnapshotReader reader( data, length );
+
+	std::uint32_t	magic	= 0;
+	std::uint16_t	version	= 0;
+	std::uint16_t	flags	= 0;
+	std::uint32_t	newSeed	= 0;
+	float			newTime	= 0.0f;
+	std::uint32_t	count	= 0;
+
+	reader.Read( magic );
+	reader.Read( version );
+	reader.Read( flags );
+	reader.Read( newSeed );
+	reader.Read( newTime );
+	reader.Read( count );
+
+	if ( !reader.IsValid() || magic != ReplayMagic || version != ReplayVersion || newTime <= 0.0f ) {
+		return false;
+	}
+
+	if ( reader.GetRemaining() / ReplayTickSize < count ) {
+		return false;
+	}
+
+	Reset( newSeed, newTime, flags != 0 );
+	ticks.resize( count );
+
+	for ( auto &tick : ticks ) {
+		reader.Read( tick.PlayerDelta );
+		reader.Read( tick.EventCount );
+		tick.FirstEvent = static_cast<std::uint32_t>( events.size() );
+
+		for ( std::uint8_t i = 0; i < tick.EventCount && reader.IsValid(); ++i ) {
+			REPLAY_EVENT replayEvent;
+			reader.Read( replayEvent );
+
+			if ( replayEvent < REPLAY_EVENT::PAUSE || replayEvent > REPLAY_EVENT::QUIT ) {
+				reader.Invalidate();
+			}
+
+			events.push_back( replayEvent );
+		}
+	}
+
+	return reader.IsValid();
+}//Load()
+
+std::uint32_t Replay::Play( GameplayManager *level, const std::uint8_t *pixels, std::uint32_t length ) const {
+	if ( !level || !level->IsInitialized() ) {
+		return 0;
+	}
+
+	level->Resize( isWidescreen );
+	level->SetSeed( seed );
+	level->Load( pixels, length );
+
+	std::uint32_t index = 0;
+	for ( const auto &tick : ticks ) {
+		for ( std::uint8_t i = 0; i < tick.EventCount; ++i ) {
+			switch ( GetEvent( tick, i ) ) {
+			case REPLAY_EVENT::PAUSE:
+				level->SetPause( true );
+				break;
+			case REPLAY_EVENT::RESUME:
+				level->SetPause( false );
+				break;
+			case REPLAY_EVENT::QUIT:
+				level->QuitGame();
+				break;
+			}
+		}
+
+		level->Update( XMVectorSet( tick.PlayerDelta, 0.0f, 0.0f, 0.0f ), tickTime, tickTime * static_cast<float>( index ) );
+		++index;
+	}
+
+	return index;
+}//Play()
@@ -0,0 +1,83 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace BreakIt {
+	namespace Objects {
+		class GameplayManager;
+
+		enum class REPLAY_EVENT : std::uint8_t {
+			PAUSE	= 1,
+			RESUME	= 2,
+			QUIT	= 3
+		};//REPLAY_EVENT enum class
+
+		//NOTE: The events of a tick are applied in the order they were added, before the tick
+		//		is simulated. They live in one list per replay, a tick refers to its range.
+		struct ReplayTick {
+			float			PlayerDelta;
+			std::uint32_t	FirstEvent;
+			std::uint8_t	EventCount;
+		};//ReplayTick struct
+
+		//NOTE: A Replay is everything needed to run a level again exactly as it was played:
+		//		the item seed, the tick length and the paddle movement and events of every tick.
+		//		Saved replays are little endian, a 20 byte header followed by 5 bytes per tick
+		//		and one more byte for each event of that tick.
+		class Replay {
+		public:
+			explicit Replay();
+			Replay( std::uint32_t seed, float tickTime, bool widescreen );
+			~Replay();
+
+			void Reset( std::uint32_t seed, float tickTime, bool widescreen );
+			void AddEvent( REPLAY_EVENT replayEvent );
+			void AddTick( float playerDelta );
+
+			std::uint32_t		GetSeed() const;
+			float				GetTickTime() const;
+			bool				IsWidescreen() const;
+			std::uint32_t		GetTickCount() const;
+			const ReplayTick&	GetTick( std::uint32_t index ) const;
+			REPLAY_EVENT		GetEvent( const ReplayTick &tick, std::uint8_t index ) const;
+
+			std::vector<std::uint8_t>	Save() const;
+			bool						Load( const std::uint8_t *data, std::uint32_t length );
+
+			//Runs the whole replay on an initialized level as fast as possible and
+			//returns the number of ticks simulated.
+			std::uint32_t Play( GameplayManager *level, const std::uint8_t *pixels, std::uint32_t length ) const;
+
+		private:
+			std::uint32_t	seed;
+			float			tickTime;
+			bool			isWidescreen;
+			std::uint8_t	pendingEvents;
+
+			std::vector<ReplayTick>		ticks;
+			std::vector<REPLAY_EVENT>	events;
+		};//Replay class
+
+	}//Objects namespace
+}//BreakIt namespace
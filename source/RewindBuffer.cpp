@@ -0,0 +1,253 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "RewindBuffer.h"
+#include "Snapshot.h"
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+
+//Changed ranges closer than this are stored as one range, a range header costs 4 bytes
+const std::uint32_t DeltaMergeGap		= 4;
+const std::uint32_t DeltaMaximumRange	= 0xFFFF;
+
+RewindBuffer::RewindBuffer() :
+	memoryBudget( 0 ),
+	memoryUsage( 0 ),
+	keyframeInterval( 1 ),
+	sinceKeyframe( 0 ) {
+}//Ctor()
+
+RewindBuffer::RewindBuffer( std::uint32_t memoryBudget, std::uint32_t keyframeInterval ) :
+	memoryBudget( memoryBudget ),
+	memoryUsage( 0 ),
+	keyframeInterval( std::max<std::uint32_t>( keyframeInterval, 1U ) ),
+	sinceKeyframe( 0 ) {
+}//Ctor()
+
+RewindBuffer::~RewindBuffer() {
+}//Dtor()
+
+void RewindBuffer::Reset( std::uint32_t memoryBudget, std::uint32_t keyframeInterval ) {
+	this->memoryBudget		= memoryBudget;
+	this->keyframeInterval	= std::max<std::uint32_t>( keyframeInterval, 1U );
+	Clear();
+}//Reset()
+
+void RewindBuffer::Clear() {
+	frames.clear();
+	lastSnapshot.clear();
+	memoryUsage		= 0;
+	sinceKeyframe	= 0;
+}//Clear()
+
+void RewindBuffer::Push( std::uint32_t tick, const std::vector<std::uint8_t> &snapshot ) {
+	//A new level or a restored foreign snapshot starts a new history
+	if ( !frames.empty() && tick <= frames.back().Tick ) {
+		Clear();
+	}
+
+	frames.push_back( Frame() );
+
+	auto &frame			= frames.back();
+	frame.Tick			= tick;
+	frame.IsKeyframe	= sinceKeyframe == 0 || sinceKeyframe >= keyframeInterval;
+
+	if ( !frame.IsKeyframe ) {
+		EncodeDelta( snapshot, frame.Data );
+
+		if ( frame.Data.size() >= snapshot.size() ) {
+			frame.IsKeyframe = true;
+		}
+	}
+
+	if ( frame.IsKeyframe ) {
+		frame.Data		= snapshot;
+		sinceKeyframe	= 0;
+	}
+
+	++sinceKeyframe;
+	memoryUsage += static_cast<std::uint32_t>( sizeof( Frame ) + frame.Data.size() );
+	lastSnapshot = snapshot;
+
+	Trim();
+}//Push()
+
+bool RewindBuffer::Restore( std::uint32_t tick, std::vector<std::uint8_t> &snapshot ) {
+	if ( frames.empty() || tick < frames.front().Tick ) {
+		return false;
+	}
+
+	//Latest frame at or before tick, then back to the keyframe it is based on
+	auto target = std::upper_bound(
+		std::begin( frames ),
+		std::end( frames ),
+		tick,
+		[]( std::uint32_t value, const Frame &frame ) { return value < frame.Tick; }
+		) - 1;
+
+	auto keyframe = target;
+	while ( !keyframe->IsKeyframe ) {
+		--keyframe;
+	}
+
+	snapshot = keyframe->Data;
+	for ( auto it = keyframe + 1; it <= target; ++it ) {
+		if ( !ApplyDelta( it->Data, snapshot ) ) {
+			return false;
+		}
+	}
+
+	for ( auto it = target + 1; it != std::end( frames ); ++it ) {
+		memoryUsage -= static_cast<std::uint32_t>( sizeof( Frame ) + it->Data.size() );
+	}
+
+	sinceKeyframe = static_cast<std::uint32_t>( target - keyframe ) + 1;
+	frames.erase( target + 1, std::end( frames ) );
+	lastSnapshot = snapshot;
+
+	return true;
+}//Restore()
+
+bool RewindBuffer::IsEmpty() const {
+	return frames.empty();
+}//IsEmpty()
+
+std::uint32_t RewindBuffer::GetFirstTick() const {
+	return frames.empty() ? 0 : frames.front().Tick;
+}//GetFirstTick()
+
+std::uint32_t RewindBuffer::GetLastTick() const {
+	return frames.empty() ? 0 : frames.back().Tick;
+}//GetLastTick()
+
+std::uint32_t RewindBuffer::GetTickCount() const {
+	return static_cast<std::uint32_t>( frames.size() );
+}//GetTickCount()
+
+std::uint32_t RewindBuffer::GetMemoryUsage() const {
+	return memoryUsage;
+}//GetMemoryUsage()
+
+//NOTE: A delta is the new snapshot length followed by ranges of ( skip, length, bytes ).
+//		skip counts the unchanged bytes since the end of the previous range.
+void RewindBuffer::EncodeDelta( const std::vector<std::uint8_t> &snapshot, std::vector<std::uint8_t> &delta ) const {
+	auto size	= static_cast<std::uint32_t>( snapshot.size() );
+	auto common	= std::min<std::uint32_t>( size, static_cast<std::uint32_t>( lastSnapshot.size() ) );
+
+	SnapshotWriter writer( delta );
+	writer.Write( size );
+
+	std::uint32_t rangeEnd	= 0;
+	std::uint32_t i			= 0;
+
+	while ( i < size ) {
+		if ( i < common && snapshot[i] == lastSnapshot[i] ) {
+			++i;
+			continue;
+		}
+
+		std::uint32_t start = i;
+		std::uint32_t end	= i + 1;
+
+		for ( std::uint32_t j = end; j < size && j - end < DeltaMergeGap; ++j ) {
+			if ( j >= common || snapshot[j] != lastSnapshot[j] ) {
+				end = j + 1;
+			}
+		}
+
+		while ( start - rangeEnd > DeltaMaximumRange ) {
+			writer.Write( static_cast<std::uint16_t>( DeltaMaximumRange ) );
+			writer.Write( static_cast<std::uint16_t>( 0 ) );
+			rangeEnd += DeltaMaximumRange;
+		}
+
+		while ( start < end ) {
+			auto length = std::min<std::uint32_t>( end - start, DeltaMaximumRange );
+
+			writer.Write( static_cast<std::uint16_t>( start - rangeEnd ) );
+			writer.Write( static_cast<std::uint16_t>( length ) );
+			writer.Write( &snapshot[start], length );
+
+			start		+= length;
+			rangeEnd	= start;
+		}
+
+		i = end;
+	}
+}//EncodeDelta()
+
+bool RewindBuffer::ApplyDelta( const std::vector<std::uint8_t> &delta, std::vector<std::uint8_t> &snapshot ) const {
+	SnapshotReader reader( delta.data(), static_cast<std::uint32_t>( delta.size() ) );
+	std::uint32_t size = 0;
+
+	if ( !reader.Read( size ) ) {
+		return false;
+	}
+
+	snapshot.resize( size );
+
+	std::uint32_t position = 0;
+	while ( reader.GetRemaining() > 0 ) {
+		std::uint16_t skip		= 0;
+		std::uint16_t length	= 0;
+
+		reader.Read( skip );
+		reader.Read( length );
+		position += skip;
+
+		if ( !reader.IsValid() || position + length > size ) {
+			return false;
+		}
+
+		if ( length > 0 && !reader.Read( &snapshot[position], length ) ) {
+			return false;
+		}
+
+		position += length;
+	}
+
+	return true;
+}//ApplyDelta()
+
+void RewindBuffer::Trim() {
+	while ( memoryUsage > memoryBudget ) {
+		//The oldest keyframe and its deltas go together, the newest group always stays
+		auto next = std::find_if(
+			std::begin( frames ) + 1,
+			std::end( frames ),
+			[]( const Frame &frame ) { return frame.IsKeyframe; }
+			);
+
+		if ( next == std::end( frames ) ) {
+			return;
+		}
+
+		for ( auto it = std::begin( frames ); it != next; ++it ) {
+			memoryUsage -= static_cast<std::uint32_t>( sizeof( Frame ) + it->Data.size() );
+		}
+
+		frames.erase( std::begin( frames ), next );
+	}
+}//Trim()
@@ -0,0 +1,71 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace BreakIt {
+	namespace Objects {
+		//NOTE: History of level snapshots, one per tick. Every keyframe is a full snapshot and
+		//		every other tick only stores the byte ranges that changed since the tick before,
+		//		which for a running level is mostly moving balls and items and a few bricks.
+		//		The oldest ticks are dropped, a keyframe at a time, to stay inside the budget.
+		class RewindBuffer {
+		public:
+			explicit RewindBuffer();
+			RewindBuffer( std::uint32_t memoryBudget, std::uint32_t keyframeInterval );
+			~RewindBuffer();
+
+			void Reset( std::uint32_t memoryBudget, std::uint32_t keyframeInterval );
+			void Clear();
+			void Push( std::uint32_t tick, const std::vector<std::uint8_t> &snapshot );
+
+			//Rebuilds the snapshot of a retained tick and forgets every tick after it
+			bool Restore( std::uint32_t tick, std::vector<std::uint8_t> &snapshot );
+
+			bool			IsEmpty() const;
+			std::uint32_t	GetFirstTick() const;
+			std::uint32_t	GetLastTick() const;
+			std::uint32_t	GetTickCount() const;
+			std::uint32_t	GetMemoryUsage() const;
+
+		private:
+			struct Frame {
+				std::uint32_t				Tick;
+				bool						IsKeyframe;
+				std::vector<std::uint8_t>	Data;
+			};//Frame struct
+
+			void EncodeDelta( const std::vector<std::uint8_t> &snapshot, std::vector<std::uint8_t> &delta ) const;
+			bool ApplyDelta( const std::vector<std::uint8_t> &delta, std::vector<std::uint8_t> &snapshot ) const;
+			void Trim();
+
+			std::deque<Frame>			frames;
+			std::vector<std::uint8_t>	lastSnapshot;
+			std::uint32_t				memoryBudget;
+			std::uint32_t				memoryUsage;
+			std::uint32_t				keyframeInterval;
+			std::uint32_t				sinceKeyframe;
+		};//RewindBuffer class
+
+	}//Objects namespace
+}//BreakIt namespace
@@ -0,0 +1,74 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "Snapshot.h"
+#include <cstring>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+
+SnapshotWriter::SnapshotWriter( std::vector<std::uint8_t> &data ) :
+	data( data ) {
+}//Ctor()
+
+SnapshotWriter::~SnapshotWriter() {
+}//Dtor()
+
+void SnapshotWriter::Write( const void *source, std::uint32_t size ) {
+	auto bytes = static_cast<const std::uint8_t*>( source );
+	data.insert( std::end( data ), bytes, bytes + size );
+}//Write()
+
+SnapshotReader::SnapshotReader( const std::uint8_t *data, std::uint32_t length ) :
+	data( data ),
+	length( data ? length : 0 ),
+	position( 0 ),
+	isValid( data != nullptr ) {
+}//Ctor()
+
+SnapshotReader::~SnapshotReader() {
+}//Dtor()
+
+bool SnapshotReader::Read( void *target, std::uint32_t size ) {
+	if ( !isValid || size > length - position ) {
+		isValid = false;
+		return false;
+	}
+
+	std::memcpy( target, data + position, size );
+	position += size;
+	return true;
+}//Read()
+
+void SnapshotReader::Invalidate() {
+	isValid = false;
+}//Invalidate()
+
+bool SnapshotReader::IsValid() const {
+	return isValid;
+}//IsValid()
+
+std::uint32_t SnapshotReader::GetRemaining() const {
+	return length - position;
+}//GetRemaining()
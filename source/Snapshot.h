@@ -0,0 +1,74 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace BreakIt {
+	namespace Objects {
+		//NOTE: Byte streams for saving and restoring simulation state. Values are copied
+		//		bytewise, so a snapshot is only meant to be read back by the same build.
+		class SnapshotWriter {
+		public:
+			explicit SnapshotWriter( std::vector<std::uint8_t> &data );
+			~SnapshotWriter();
+
+			void Write( const void *source, std::uint32_t size );
+
+			template<typename T>
+			void Write( const T &value ) {
+				Write( &value, sizeof( T ) );
+			}//Write<>()
+
+		private:
+			SnapshotWriter& operator=( const SnapshotWriter& );
+
+			std::vector<std::uint8_t> &data;
+		};//SnapshotWriter class
+
+		class SnapshotReader {
+		public:
+			SnapshotReader( const std::uint8_t *data, std::uint32_t length );
+			~SnapshotReader();
+
+			//Once a read runs past the end every further read fails as well
+			bool Read( void *target, std::uint32_t size );
+
+			template<typename T>
+			bool Read( T &value ) {
+				return Read( &value, sizeof( T ) );
+			}//Read<>()
+
+			//Marks the stream as failed when a value read back is out of range
+			void			Invalidate();
+			bool			IsValid() const;
+			std::uint32_t	GetRemaining() const;
+
+		private:
+			const std::uint8_t	*data;
+			std::uint32_t		length;
+			std::uint32_t		position;
+			bool				isValid;
+		};//SnapshotReader class
+
+	}//Objects namespace
+}//BreakIt namespace
@@ -28,48 +28,110 @@ using namespace WinGame;
 using namespace WinGame::Audio;
 
 Sound::Sound() :
-	isInitialized( false ) {
+	isInitialized( false ),
+	voices( 0 ),
+	playCount( 0 ),
+	audioData( nullptr ),
+	audioBytes( 0 ) {
+
+	stealCount.store( 0 );
+	dropCount.store( 0 );
 }//Ctor()
 
 Sound::~Sound() {
-	if ( isInitialized ) {
-		sourceVoice->DestroyVoice();
+	//Plays of this sound may still be waiting in the audio queue
+	if ( thread ) {
+		thread->Synchronize();
+	}
 
-		isInitialized	= false;
-		sourceVoice		= nullptr;
-		data			= nullptr;
+	//Voices are destroyed even if creating the sound failed halfway
+	for ( auto &voice : voices ) {
+		voice.SourceVoice->DestroyVoice();
 	}
+
+	isInitialized	= false;
+	audioData		= nullptr;
+	voices.clear();
 }//Dtor()
 
 bool Sound::IsInitialized() const {
 	return isInitialized;
 }//IsInitialized()
 
-void Sound::Play( float volume ) {
+bool Sound::Play( float volume, bool canSteal ) {
 	if ( !isInitialized ) {
-		return;
+		return false;
 	}
 
-	Utility::ThrowIfFailed(
-		sourceVoice->Stop()
-		);
+	return thread->PlaySound( this, volume, canSteal );
+}//Play()
+
+bool Sound::Start( float volume, bool canSteal ) {
+	Voice *target = nullptr;
+	Voice *oldest = &voices[0];
+
+	for ( auto &voice : voices ) {
+		XAUDIO2_VOICE_STATE state;
+		voice.SourceVoice->GetState( &state, XAUDIO2_VOICE_NOSAMPLESPLAYED );
 
-	Utility::ThrowIfFailed(
-		sourceVoice->FlushSourceBuffers()
-		);
+		if ( state.BuffersQueued == 0 ) {
+			target = &voice;
+			break;
+		}
+
+		if ( voice.PlayIndex < oldest->PlayIndex ) {
+			oldest = &voice;
+		}
+	}
 
 	XAUDIO2_BUFFER buffer = {0};
-	buffer.AudioBytes	= data->Length;
-	buffer.pAudioData	= data->Data;
+	buffer.AudioBytes	= audioBytes;
+	buffer.pAudioData	= audioData;
 	buffer.Flags		= XAUDIO2_END_OF_STREAM;
 
-	sourceVoice->SetVolume( volume );
+	if ( target ) {
+		//Idle voices keep running, the buffer starts playing as soon as it is queued
+		target->SourceVoice->SetVolume( volume );
 
-	Utility::ThrowIfFailed(
-		sourceVoice->SubmitSourceBuffer( &buffer )
-		);
+		Utility::ThrowIfFailed(
+			target->SourceVoice->SubmitSourceBuffer( &buffer )
+			);
+	} else {
+		if ( !canSteal ) {
+			dropCount.fetch_add( 1, std::memory_order_relaxed );
+			return false;
+		}
 
-	Utility::ThrowIfFailed(
-		sourceVoice->Start()
-		);
-}//Play()
+		target = oldest;
+		stealCount.fetch_add( 1, std::memory_order_relaxed );
+
+		Utility::ThrowIfFailed(
+			target->SourceVoice->Stop()
+			);
+
+		Utility::ThrowIfFailed(
+			target->SourceVoice->FlushSourceBuffers()
+			);
+
+		target->SourceVoice->SetVolume( volume );
+
+		Utility::ThrowIfFailed(
+			target->SourceVoice->SubmitSourceBuffer( &buffer )
+			);
+
+		Utility::ThrowIfFailed(
+			target->SourceVoice->Start()
+			);
+	}
+
+	target->PlayIndex = ++playCount;
+	return true;
+}//Start()
+
+std::uint32_t Sound::GetStealCount() const {
+	return stealCount.load( std::memory_order_relaxed );
+}//GetStealCount()
+
+std::uint32_t Sound::GetDropCount() const {
+	return dropCount.load( std::memory_order_relaxed );
+}//GetDropCount()
@@ -23,23 +23,55 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+#include "AudioThread.h"
+#include "SoundBank.h"
+
 namespace WinGame {
 	namespace Audio {
+		const std::size_t MaximumSoundVoices = 4U;
+
+		//NOTE: A sound owns a small pool of started voices, so overlapping plays do not cut
+		//		each other off and a free voice only needs a buffer submitted. With every voice
+		//		busy the one that started first is stolen, or the play is dropped. Play() only
+		//		queues the request, the voice is started on the audio thread.
 		class Sound {
 			friend class AudioManager;
+			friend class AudioThread;
 
 		public:
 			explicit Sound();
 			virtual ~Sound();
 
 			bool IsInitialized() const;
-			void Play( float volume = 1.0f );
+
+			//Returns false if the audio queue was full
+			bool Play( float volume = 1.0f, bool canSteal = true );
+
+			std::uint32_t GetStealCount() const;
+			std::uint32_t GetDropCount() const;
 
 		private:
+			struct Voice {
+				IXAudio2SourceVoice	*SourceVoice;
+				std::uint64_t		PlayIndex;
+			};//Voice struct
+
+			//Audio thread, returns false if every voice was busy and stealing was not allowed
+			bool Start( float volume, bool canSteal );
+
 			bool isInitialized;
 
-			IXAudio2SourceVoice		*sourceVoice;
-			Platform::Array<byte>	^data;
+			std::shared_ptr<AudioThread>	thread;
+			std::vector<Voice>				voices;
+			std::uint64_t					playCount;
+			std::atomic<std::uint32_t>		stealCount;
+			std::atomic<std::uint32_t>		dropCount;
+
+			//The samples either point into a mapped sound bank or at decodedData
+			const byte							*audioData;
+			std::uint32_t						audioBytes;
+			std::vector<byte>					decodedData;
+			std::shared_ptr<const SoundBank>	bank;
 
 		};//Sound class
 
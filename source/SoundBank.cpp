@@ -0,0 +1,149 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "SoundBank.h"
+#include "MappedFile.h"
+
+using namespace WinGame;
+using namespace WinGame::Audio;
+
+SoundBank::SoundBank() :
+	view( nullptr ),
+	size( 0 ),
+	header( nullptr ),
+	entries( nullptr ) {
+}//Ctor()
+
+SoundBank::~SoundBank() {
+	Close();
+}//Dtor()
+
+bool SoundBank::Open( const wchar_t *filename ) {
+	auto mappedFile = std::make_shared<Content::MappedFile>();
+
+	if ( !mappedFile->Open( filename ) ) {
+		Close();
+		return false;
+	}
+
+	return Open( mappedFile->GetData(), mappedFile->GetSize(), mappedFile );
+}//Open()
+
+bool SoundBank::Open( const byte *data, std::uint64_t length, std::shared_ptr<const void> owner ) {
+	Close();
+
+	if ( !data || length < sizeof( SoundBankHeader ) ) {
+		return false;
+	}
+
+	this->owner	= owner;
+	view		= data;
+	size		= length;
+	header		= reinterpret_cast<const SoundBankHeader*>( view );
+	entries		= reinterpret_cast<const SoundBankEntry*>( view + sizeof( SoundBankHeader ) );
+
+	if ( !Validate() ) {
+		Close();
+		return false;
+	}
+
+	return true;
+}//Open()
+
+//Everything a voice could read has to be inside the file
+bool SoundBank::Validate() const {
+	if ( header->Magic != SoundBankMagic || header->Version != SoundBankVersion ) {
+		return false;
+	}
+
+	if ( header->SampleRate != SoundBankSampleRate || header->ChannelCount != SoundBankChannelCount || header->BitsPerSample != 16 ) {
+		return false;
+	}
+
+	if ( sizeof( SoundBankHeader ) + static_cast<std::uint64_t>( header->EntryCount ) * sizeof( SoundBankEntry ) > size ) {
+		return false;
+	}
+
+	const std::uint64_t blockAlign = header->ChannelCount * sizeof( std::int16_t );
+
+	for ( std::uint32_t i = 0; i < header->EntryCount; ++i ) {
+		const auto &entry = entries[i];
+
+		if ( entry.Offset % SoundBankAlignment != 0 || entry.Offset + ( entry.FrameCount + 1ULL ) * blockAlign > size ) {
+			return false;
+		}
+
+		//Find() relies on the order
+		if ( i > 0 && entries[i - 1].NameHash >= entry.NameHash ) {
+			return false;
+		}
+	}
+
+	return true;
+}//Validate()
+
+void SoundBank::Close() {
+	owner	= nullptr;
+	view	= nullptr;
+	size	= 0;
+	header	= nullptr;
+	entries	= nullptr;
+}//Close()
+
+bool SoundBank::IsOpen() const {
+	return view != nullptr;
+}//IsOpen()
+
+const SoundBankEntry* SoundBank::Find( const wchar_t *name ) const {
+	if ( !view ) {
+		return nullptr;
+	}
+
+	auto hash	= HashSoundName( name );
+	auto last	= entries + header->EntryCount;
+	auto entry	= std::lower_bound( entries, last, hash, []( const SoundBankEntry &left, std::uint64_t right ) {
+		return left.NameHash < right;
+	} );
+
+	return ( entry != last && entry->NameHash == hash ) ? entry : nullptr;
+}//Find()
+
+const byte* SoundBank::GetData( const SoundBankEntry *entry ) const {
+	return view + entry->Offset;
+}//GetData()
+
+std::uint32_t SoundBank::GetDataSize( const SoundBankEntry *entry ) const {
+	return entry->FrameCount * header->ChannelCount * sizeof( std::int16_t );
+}//GetDataSize()
+
+void SoundBank::GetFormat( WAVEFORMATEX &format ) const {
+	ZeroMemory( &format, sizeof( format ) );
+
+	format.wFormatTag		= WAVE_FORMAT_PCM;
+	format.nChannels		= header->ChannelCount;
+	format.nSamplesPerSec	= header->SampleRate;
+	format.wBitsPerSample	= header->BitsPerSample;
+	format.nBlockAlign		= static_cast<WORD>( header->ChannelCount * sizeof( std::int16_t ) );
+	format.nAvgBytesPerSec	= format.nSamplesPerSec * format.nBlockAlign;
+}//GetFormat()
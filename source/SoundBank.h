@@ -0,0 +1,69 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "SoundBankFormat.h"
+
+namespace WinGame {
+	namespace Audio {
+		//NOTE: A sound bank built by the SoundBankBuilder tool, mapped into memory read only.
+		//		Sounds play straight from the mapping, nothing is decoded or copied, so the bank
+		//		has to stay open as long as a voice may read from it. Sounds hold a reference
+		//		to the bank for that reason. The bank is either its own file or a block of memory
+		//		somebody else keeps alive, e.g. an entry of an asset pack.
+		class SoundBank {
+		public:
+			explicit SoundBank();
+			~SoundBank();
+
+			//Returns false if the file is missing or not a valid bank
+			bool Open( const wchar_t *filename );
+			//The bank keeps owner alive until it is closed
+			bool Open( const byte *data, std::uint64_t length, std::shared_ptr<const void> owner );
+			void Close();
+			bool IsOpen() const;
+
+			//Returns nullptr if the bank does not contain the sound
+			const SoundBankEntry* Find( const wchar_t *name ) const;
+
+			const byte*		GetData( const SoundBankEntry *entry ) const;
+			std::uint32_t	GetDataSize( const SoundBankEntry *entry ) const;
+			void			GetFormat( WAVEFORMATEX &format ) const;
+
+		private:
+			SoundBank( const SoundBank& );
+			SoundBank& operator=( const SoundBank& );
+
+			bool Validate() const;
+
+			std::shared_ptr<const void>	owner;
+			const byte					*view;
+			std::uint64_t				size;
+			const SoundBankHeader		*header;
+			const SoundBankEntry		*entries;
+
+		};//SoundBank class
+
+	}//Audio namespace
+}//WinGame namespace
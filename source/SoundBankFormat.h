@@ -0,0 +1,64 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "AssetPackFormat.h"
+
+//NOTE: Only fixed size types and no includes of the game, the offline SoundBankBuilder tool
+//		writes banks with this header as well.
+namespace WinGame {
+	namespace Audio {
+		const std::uint32_t SoundBankMagic			= 0x4B425342;	//"BSBK"
+		const std::uint32_t SoundBankVersion		= 1U;
+		const std::uint32_t SoundBankAlignment		= 16U;
+		const std::uint32_t SoundBankSampleRate		= 44100U;
+		const std::uint16_t SoundBankChannelCount	= 2U;
+
+		//NOTE: A bank is this header, EntryCount entries sorted by NameHash and then the sample
+		//		data. Every sound is 16 bit PCM at SoundBankSampleRate with SoundBankChannelCount
+		//		channels, starts at a multiple of SoundBankAlignment and is followed by one
+		//		frame of silence, so it can be handed to voices and the Mixer as it is.
+		struct SoundBankHeader {
+			std::uint32_t	Magic;
+			std::uint32_t	Version;
+			std::uint32_t	EntryCount;
+			std::uint32_t	SampleRate;
+			std::uint16_t	ChannelCount;
+			std::uint16_t	BitsPerSample;
+			std::uint32_t	DataSize;
+		};//SoundBankHeader struct
+
+		struct SoundBankEntry {
+			std::uint64_t	NameHash;
+			std::uint32_t	Offset;			//From the start of the bank
+			std::uint32_t	FrameCount;
+		};//SoundBankEntry struct
+
+		//Same names as in an asset pack, so a bank can be looked up in both
+		inline std::uint64_t HashSoundName( const wchar_t *name ) {
+			return Content::HashAssetName( name );
+		}//HashSoundName()
+
+	}//Audio namespace
+}//WinGame namespace
@@ -24,24 +24,95 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "pch.h"
 #include "SoundManager.h"
 #include "Globals.h"
+#include <cmath>
 
 using namespace WinGame;
 using namespace WinGame::Audio;
+#ifndef BREAKIT_HEADLESS
 using namespace WinGame::Content;
 using namespace WinGame::Game;
+#endif
 using namespace BreakIt;
 using namespace BreakIt::Styles;
 using namespace BreakIt::Objects;
 using namespace DirectX;
 
+//NOTE: Sounds above priority 0 steal a voice when all of theirs are busy, the others are
+//		dropped. Losing one of many brick hits goes unnoticed, losing a lost ball does not.
+const std::uint8_t SoundPriority[SoundFileCount] = {
+	0,	//UNKNOWN
+	0,	//SIDE_HIT
+	2,	//BALL_LOST
+	1,	//PLAYER_HIT
+	0,	//BRICK_HIT
+	0,	//BRICK_BREAK
+	2,	//GAME_WON
+	2,	//GAME_LOST
+	1,	//POINTS_ADD
+	1,	//HEALTH_ADD
+	1,	//POSITIVE_ITEM
+	1,	//NEGATIVE_ITEM
+	0	//LASER_SHOT
+};
+
+//Coalesced plays may go above full volume, XAudio2 amplifies up to this
+const float MaximumCoalescedVolume = 2.0f;
+
+//Style filenames are Windows paths relative to the package folder
+static std::string GetMixerPath( const std::string &root, const wchar_t *filename ) {
+	std::string path = root;
+
+	if ( !path.empty() && path.back() != '/' ) {
+		path.push_back( '/' );
+	}
+
+	for ( auto c = filename; *c; ++c ) {
+		path.push_back( *c == L'\\' ? '/' : static_cast<char>( *c ) );
+	}
+
+	return path;
+}//GetMixerPath()
+
+struct PendingSound {
+	std::uint32_t	Count;
+	float			Volume;
+};//PendingSound struct
+
 class SoundManager::Impl {
 public:
 	Impl();
 
+#ifndef BREAKIT_HEADLESS
 	std::map<SOUND_FILE, std::shared_ptr<Sound>> Sounds;
+	AudioManager *audio;
+#endif
+
+	Mixer		*mixer;
+	PcmBuffer	mixerSounds[SoundFileCount];
+
+	PendingSound	pending[SoundFileCount];
+	std::uint64_t	coalescedCount;
+	std::uint64_t	droppedCount;
 };//SoundManager::Impl class
 
-SoundManager::Impl::Impl() {
+SoundManager::Impl::Impl() :
+#ifndef BREAKIT_HEADLESS
+	audio( nullptr ),
+#endif
+	mixer( nullptr ),
+	coalescedCount( 0 ),
+	droppedCount( 0 ) {
+
+	for ( auto &pcm : mixerSounds ) {
+		pcm.FrameCount		= 0;
+		pcm.ChannelCount	= 0;
+		pcm.SampleRate		= 0;
+	}
+
+	for ( auto &request : pending ) {
+		request.Count	= 0;
+		request.Volume	= 0.0f;
+	}
 }//Ctor()
 
 SoundManager::SoundManager() :
@@ -53,12 +124,15 @@ SoundManager::~SoundManager() {
 
 UTILITY_CLASS_PIMPL_IMPL( SoundManager );
 
+#ifndef BREAKIT_HEADLESS
 void SoundManager::Initialize( GameManager *manager ) {
 	auto content	= manager->GetGameplayContent();
 	auto audio		= manager->GetAudioManager();
 	auto style		= manager->GetStyleManager();
 
 	pImpl->Sounds.clear();
+	pImpl->audio = audio;
+	pImpl->mixer = nullptr;
 
 	//Load Audio Content
 	pImpl->Sounds[SOUND_FILE::BALL_LOST]		= content->LoadSound( audio, style->GetBallLostSound() );
@@ -74,15 +148,131 @@ void SoundManager::Initialize( GameManager *manager ) {
 	pImpl->Sounds[SOUND_FILE::POSITIVE_ITEM]	= content->LoadSound( audio, style->GetPositiveItemSound() );
 	pImpl->Sounds[SOUND_FILE::LASER_SHOT]		= content->LoadSound( audio, style->GetLaserShotSound() );
 }//Initialize()
+#endif
+
+void SoundManager::Initialize( Mixer *mixer, const IStyle *style, const std::string &root ) {
+#ifndef BREAKIT_HEADLESS
+	pImpl->Sounds.clear();
+	pImpl->audio = nullptr;
+#endif
+	pImpl->mixer = mixer;
+
+	//Voices still playing the buffers about to be replaced
+	mixer->StopAll();
+
+	auto load = [this, &root]( SOUND_FILE file, const wchar_t *filename ) {
+		auto &pcm = pImpl->mixerSounds[static_cast<std::uint32_t>( file )];
+
+		//A missing or unsupported file stays silent
+		if ( !LoadWaveFile( GetMixerPath( root, filename ), pcm ) ) {
+			pcm.Samples.clear();
+			pcm.FrameCount = 0;
+		}
+	};
+
+	load( SOUND_FILE::BALL_LOST,		style->GetBallLostSound() );
+	load( SOUND_FILE::BRICK_BREAK,		style->GetBrickBreakSound() );
+	load( SOUND_FILE::BRICK_HIT,		style->GetBrickHitSound() );
+	load( SOUND_FILE::POINTS_ADD,		style->GetPointsAddSound() );
+	load( SOUND_FILE::GAME_LOST,		style->GetGameLostSound() );
+	load( SOUND_FILE::GAME_WON,			style->GetGameWonSound() );
+	load( SOUND_FILE::HEALTH_ADD,		style->GetHealthAddSound() );
+	load( SOUND_FILE::PLAYER_HIT,		style->GetPlayerHitSound() );
+	load( SOUND_FILE::SIDE_HIT,			style->GetSideHitSound() );
+	load( SOUND_FILE::NEGATIVE_ITEM,	style->GetNegativeItemSound() );
+	load( SOUND_FILE::POSITIVE_ITEM,	style->GetPositiveItemSound() );
+	load( SOUND_FILE::LASER_SHOT,		style->GetLaserShotSound() );
+}//Initialize()
 
 void SoundManager::PlaySound( SOUND_FILE file, float volume ) {
 	if ( file == SOUND_FILE::UNKNOWN ) {
 		return;
 	}
 
-	pImpl->Sounds[file]->Play( volume );
+	auto &request = pImpl->pending[static_cast<std::uint32_t>( file )];
+
+	++request.Count;
+	request.Volume = std::max<float>( request.Volume, volume );
 }//PlaySound()
 
+void SoundManager::Flush() {
+	for ( std::uint32_t i = 0; i < SoundFileCount; ++i ) {
+		auto &request = pImpl->pending[i];
+
+		if ( request.Count == 0 ) {
+			continue;
+		}
+
+		//NOTE: n hits at once are played as one at sqrt(n) times the loudest volume, roughly
+		//		how loud n copies starting at slightly different times would add up.
+		float volume = std::min<float>( request.Volume * std::sqrt( static_cast<float>( request.Count ) ), MaximumCoalescedVolume );
+		pImpl->coalescedCount += request.Count - 1;
+
+		request.Count	= 0;
+		request.Volume	= 0.0f;
+
+		if ( pImpl->mixer ) {
+			auto &pcm = pImpl->mixerSounds[i];
+
+			if ( pcm.FrameCount > 0 && !pImpl->mixer->Play( &pcm, volume, 0.0f, SoundPriority[i] > 0 ) ) {
+				++pImpl->droppedCount;
+			}
+
+			continue;
+		}
+
+#ifndef BREAKIT_HEADLESS
+		//Nothing is loaded when running without an audio device
+		auto sound = pImpl->Sounds.find( static_cast<SOUND_FILE>( i ) );
+
+		if ( sound != std::end( pImpl->Sounds ) && sound->second ) {
+			if ( !sound->second->Play( volume, SoundPriority[i] > 0 ) ) {
+				++pImpl->droppedCount;
+			}
+		}
+#endif
+	}
+
+#ifndef BREAKIT_HEADLESS
+	//One wake up per frame instead of one per sound
+	if ( pImpl->audio ) {
+		pImpl->audio->Commit();
+	}
+#endif
+}//Flush()
+
+std::uint64_t SoundManager::GetCoalescedCount() const {
+	return pImpl->coalescedCount;
+}//GetCoalescedCount()
+
+std::uint64_t SoundManager::GetStealCount() const {
+	std::uint64_t steals = pImpl->mixer ? pImpl->mixer->GetStealCount() : 0;
+
+#ifndef BREAKIT_HEADLESS
+	for ( const auto &sound : pImpl->Sounds ) {
+		if ( sound.second ) {
+			steals += sound.second->GetStealCount();
+		}
+	}
+#endif
+
+	return steals;
+}//GetStealCount()
+
+std::uint64_t SoundManager::GetDroppedCount() const {
+	std::uint64_t drops = pImpl->droppedCount;
+
+#ifndef BREAKIT_HEADLESS
+	for ( const auto &sound : pImpl->Sounds ) {
+		if ( sound.second ) {
+			drops += sound.second->GetDropCount();
+		}
+	}
+#endif
+
+	return drops;
+}//GetDroppedCount()
+
 void SoundManager::PlayItemSound( ITEM_TYPES type, float volume ) {
 	switch ( type ) {
 	case ITEM_TYPES::DIAMOND:
@@ -23,37 +23,41 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+#include "ISoundObserver.h"
+#include "Mixer.h"
+#include "IStyle.h"
+
+#ifndef BREAKIT_HEADLESS
 #include "Sound.h"
 #include "GameManager.h"
-#include "Globals.h"
+#endif
 
 namespace BreakIt {
 	namespace Objects {
-		enum class SOUND_FILE : std::uint8_t {
-			UNKNOWN = 0x00U,
-			SIDE_HIT,
-			BALL_LOST,
-			PLAYER_HIT,
-			BRICK_HIT,
-			BRICK_BREAK,
-			GAME_WON,
-			GAME_LOST,
-			POINTS_ADD,
-			HEALTH_ADD,
-			POSITIVE_ITEM,
-			NEGATIVE_ITEM,
-			LASER_SHOT
-		};//SOUND_FILE enum class
-
-		class SoundManager {
+		//NOTE: PlaySound() only collects requests, Flush() plays them once per tick. The same
+		//		sound requested several times in one tick is played once and louder.
+		class SoundManager : public ISoundObserver {
 		public:
 			explicit SoundManager();
 			virtual ~SoundManager();
 			UTILITY_CLASS_MOVE( SoundManager );
 
+#ifndef BREAKIT_HEADLESS
 			void Initialize( WinGame::Game::GameManager *manager );
-			void PlaySound( SOUND_FILE file, float volume = 1.0f );
-			void PlayItemSound( ITEM_TYPES type, float volume = 1.0f );
+#endif
+
+			//Plays through a software mixer instead of XAudio2, reading the .wav files of the
+			//style from below root. Needs no GameManager, so headless games can have sound too.
+			void Initialize( WinGame::Audio::Mixer *mixer, const Styles::IStyle *style, const std::string &root );
+			virtual void PlaySound( SOUND_FILE file, float volume = 1.0f ) override;
+			virtual void PlayItemSound( ITEM_TYPES type, float volume = 1.0f ) override;
+			virtual void Flush() override;
+
+			//Requests merged into another play, voices stolen and plays dropped for lack of a voice
+			//or of room in the audio queue
+			std::uint64_t GetCoalescedCount() const;
+			std::uint64_t GetStealCount() const;
+			std::uint64_t GetDroppedCount() const;
 
 		private:
 			UTILITY_CLASS_COPY( SoundManager );
@@ -0,0 +1,91 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+namespace WinGame {
+	namespace Audio {
+		const std::size_t CacheLineSize = 64U;
+
+		//NOTE: Bounded single producer, single consumer ring buffer. Push() may only be called
+		//		from one thread and Pop() from one other thread, neither ever blocks or takes a
+		//		lock. Each side only writes its own index, the other side reads it with acquire
+		//		ordering so the slot contents are visible before the index moves past them.
+		//		The indices sit on separate cache lines so the two threads do not share one.
+		template<typename T, std::size_t Capacity>
+		class SpscQueue {
+			static_assert( Capacity > 1 && ( Capacity & ( Capacity - 1 ) ) == 0, "Capacity has to be a power of two" );
+
+		public:
+			SpscQueue() {
+				head.store( 0, std::memory_order_relaxed );
+				tail.store( 0, std::memory_order_relaxed );
+			}//Ctor()
+
+			~SpscQueue() {
+			}//Dtor()
+
+			//Producer only, returns false if the queue is full
+			bool Push( const T &item ) {
+				auto currentTail = tail.load( std::memory_order_relaxed );
+
+				if ( currentTail - head.load( std::memory_order_acquire ) == Capacity ) {
+					return false;
+				}
+
+				items[currentTail & ( Capacity - 1 )] = item;
+				tail.store( currentTail + 1, std::memory_order_release );
+				return true;
+			}//Push()
+
+			//Consumer only, returns false if the queue is empty
+			bool Pop( T &item ) {
+				auto currentHead = head.load( std::memory_order_relaxed );
+
+				if ( currentHead == tail.load( std::memory_order_acquire ) ) {
+					return false;
+				}
+
+				item = items[currentHead & ( Capacity - 1 )];
+				head.store( currentHead + 1, std::memory_order_release );
+				return true;
+			}//Pop()
+
+			//Only exact when called from the consumer thread
+			bool IsEmpty() const {
+				return head.load( std::memory_order_acquire ) == tail.load( std::memory_order_acquire );
+			}//IsEmpty()
+
+		private:
+			SpscQueue( const SpscQueue& );
+			SpscQueue& operator=( const SpscQueue& );
+
+			std::atomic<std::size_t>	head;
+			char						headPadding[CacheLineSize - sizeof( std::atomic<std::size_t> )];
+			std::atomic<std::size_t>	tail;
+			char						tailPadding[CacheLineSize - sizeof( std::atomic<std::size_t> )];
+			T							items[Capacity];
+		};//SpscQueue class
+
+	}//Audio namespace
+}//WinGame namespace
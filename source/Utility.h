@@ -32,6 +32,8 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 // #define UTILITY_NO_STANDARD_MAKE_UNIQUE	-> use this if you want to have an std::make_unique and it is not implemented yet.
 // #define UTILITY_NO_VARIADIC_TEMPLATES	-> use this if your compiler has no support for variadic Templates but you still want to use std::make_unique
 //												UTILITY_NO_STANDARD_MAKE_UNIQUE has to be pre-defined before
+// #define UTILITY_PORTABLE					-> use this to build without any Windows header, debug messages go to stderr and
+//												BasicTimer runs on std::chrono. Not together with UTILITY_WINDOWS_RUNTIME
 // -----------------------------------------------------------------
 #pragma once
 
@@ -74,7 +76,24 @@ using namespace Concurrency;
 //Non WinT specific includes
 #include <exception>
 
+#ifdef UTILITY_PORTABLE
+
+#include <stdexcept>
+#include <string>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cwchar>
+#include <cmath>
+
+#ifndef E_FAIL
+#define E_FAIL static_cast<long>( 0x80004005L )
+#endif
+
+#define UTILITY_THROW_EX( hr ) throw std::runtime_error( "Error " + std::to_string( static_cast<long>( hr ) ) );
+#else
 #define UTILITY_THROW_EX( hr ) throw std::exception( hr );
+#endif
 
 #endif
 
@@ -88,7 +107,11 @@ using namespace Concurrency;
 #define UTILITY_CLASS_PIMPL_IMPL( type ) _UTILITY_CLASS_PIMPL_MCTOR_IMPL( type ) _UTILITY_CLASS_PIMPL_MASSIGN_IMPL( type )
 
 #ifdef _DEBUG
+#ifdef UTILITY_PORTABLE
+#define UTILITY_DEBUG_MSG( msg ) std::fputws( msg, stderr );
+#else
 #define UTILITY_DEBUG_MSG( msg ) OutputDebugString( msg );
+#endif
 #else
 #define UTILITY_DEBUG_MSG( msg )
 #endif
@@ -109,7 +132,12 @@ _UTILITY_NS_START
 		va_list args;
 		va_start( args, format );
 		wchar_t message[1024];
+#ifdef UTILITY_PORTABLE
+		vswprintf( message, 1024, format, args );
+#else
 		vswprintf_s( message, 1024, format, args );
+#endif
+		va_end( args );
 		UTILITY_DEBUG_MSG( message );
 	}//WriteDebugMessage()
 
@@ -123,7 +151,7 @@ _UTILITY_NS_START
 	}//InRange()
 
 	inline int ftoi( float value ) {
-		return static_cast<int>( std::floorf( value + 0.5f ) );
+		return static_cast<int>( std::floor( value + 0.5f ) );
 	}//ftoi()
 
 #ifdef UTILITY_DIRECTX11
@@ -0,0 +1,110 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#include "pch.h"
+#include "XAudio2Output.h"
+
+using namespace WinGame;
+using namespace WinGame::Audio;
+
+XAudio2Output::XAudio2Output( IXAudio2 *engine ) :
+	engine( engine ),
+	sourceVoice( nullptr ),
+	currentBuffer( 0 ),
+	channelCount( 0 ) {
+}//Ctor()
+
+XAudio2Output::~XAudio2Output() {
+	Close();
+}//Dtor()
+
+bool XAudio2Output::Open( std::uint32_t sampleRate, std::uint32_t channelCount ) {
+	Close();
+
+	WAVEFORMATEX waveFormat = {0};
+	waveFormat.wFormatTag		= WAVE_FORMAT_PCM;
+	waveFormat.nChannels		= static_cast<WORD>( channelCount );
+	waveFormat.nSamplesPerSec	= sampleRate;
+	waveFormat.wBitsPerSample	= 16;
+	waveFormat.nBlockAlign		= static_cast<WORD>( channelCount * sizeof( std::int16_t ) );
+	waveFormat.nAvgBytesPerSec	= sampleRate * waveFormat.nBlockAlign;
+
+	if ( FAILED( engine->CreateSourceVoice( &sourceVoice, &waveFormat ) ) ) {
+		sourceVoice = nullptr;
+		return false;
+	}
+
+	for ( auto &buffer : data ) {
+		buffer.resize( MixerOutputBufferFrames * channelCount );
+	}
+
+	this->channelCount	= channelCount;
+	this->currentBuffer	= 0;
+
+	Utility::ThrowIfFailed(
+		sourceVoice->Start()
+		);
+
+	return true;
+}//Open()
+
+void XAudio2Output::Close() {
+	if ( !sourceVoice ) {
+		return;
+	}
+
+	sourceVoice->DestroyVoice();
+	sourceVoice = nullptr;
+}//Close()
+
+std::uint32_t XAudio2Output::GetWritableFrames() const {
+	if ( !sourceVoice ) {
+		return 0;
+	}
+
+	XAUDIO2_VOICE_STATE state;
+	sourceVoice->GetState( &state, XAUDIO2_VOICE_NOSAMPLESPLAYED );
+
+	return ( MixerOutputBufferCount - std::min<std::uint32_t>( state.BuffersQueued, MixerOutputBufferCount ) ) * MixerOutputBufferFrames;
+}//GetWritableFrames()
+
+void XAudio2Output::Write( const std::int16_t *frames, std::uint32_t frameCount ) {
+	while ( frameCount > 0 ) {
+		auto count	= std::min<std::uint32_t>( frameCount, MixerOutputBufferFrames );
+		auto &block	= data[currentBuffer];
+
+		std::copy( frames, frames + count * channelCount, std::begin( block ) );
+
+		XAUDIO2_BUFFER buffer = {0};
+		buffer.AudioBytes = count * channelCount * sizeof( std::int16_t );
+		buffer.pAudioData = reinterpret_cast<const BYTE*>( &block[0] );
+
+		Utility::ThrowIfFailed(
+			sourceVoice->SubmitSourceBuffer( &buffer )
+			);
+
+		currentBuffer	= ( currentBuffer + 1 ) % MixerOutputBufferCount;
+		frames			+= count * channelCount;
+		frameCount		-= count;
+	}
+}//Write()
@@ -0,0 +1,60 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+#pragma once
+
+#include "IAudioOutput.h"
+
+namespace WinGame {
+	namespace Audio {
+		const std::uint32_t MixerOutputBufferCount	= 3U;
+		const std::uint32_t MixerOutputBufferFrames	= 1024U;
+
+		//NOTE: Plays the mix through one XAudio2 source voice. The frames are copied into a
+		//		few rotating buffers like the music streaming does, the mixer is only asked for
+		//		as many frames as there are free buffers.
+		class XAudio2Output : public IAudioOutput {
+		public:
+			explicit XAudio2Output( IXAudio2 *engine );
+			virtual ~XAudio2Output();
+
+			virtual bool Open( std::uint32_t sampleRate, std::uint32_t channelCount );
+			virtual void Close();
+
+			virtual std::uint32_t	GetWritableFrames() const;
+			virtual void			Write( const std::int16_t *frames, std::uint32_t frameCount );
+
+		private:
+			XAudio2Output( const XAudio2Output& );
+			XAudio2Output& operator=( const XAudio2Output& );
+
+			Microsoft::WRL::ComPtr<IXAudio2>	engine;
+			IXAudio2SourceVoice					*sourceVoice;
+			std::vector<std::int16_t>			data[MixerOutputBufferCount];
+			std::uint32_t						currentBuffer;
+			std::uint32_t						channelCount;
+
+		};//XAudio2Output class
+
+	}//Audio namespace
+}//WinGame namespace
@@ -23,6 +23,12 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+//NOTE: BREAKIT_HEADLESS builds the gameplay simulation on its own, for any platform with a
+//		C++14 compiler and DirectXMath. Nothing of the Windows SDK, Direct3D, XAudio2, Media
+//		Foundation or the Windows Runtime is included and drawing code is left out, see the
+//		README for the files that make up the headless simulation.
+#ifndef BREAKIT_HEADLESS
+
 #define WIN32_LEAN_AND_MEAN
 
 #pragma warning(disable : 4100)		// unreferenced formal parameter
@@ -52,18 +58,33 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <agile.h>
 #include <collection.h>
 
+#else
+
+//DirectX Includes
+#include <DirectXMath.h>
+#include <DirectXColors.h>
+#include <DirectXCollision.h>
+
+#endif //BREAKIT_HEADLESS
+
 //STL includes
 #include <map>
 #include <vector>
+#include <deque>
 #include <memory>
 #include <algorithm>
 #include <functional>
 #include <string>
 #include <random>
 #include <sstream>
+#include <atomic>
+#include <thread>
 
 //C Includes
 #include <cstdint>
+#include <cstring>
+
+#ifndef BREAKIT_HEADLESS
 
 //Concurrency (Parallel Patterns Library)
 #include <ppl.h>		
@@ -76,4 +97,14 @@ OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define UTILITY_NO_VARIADIC_TEMPLATES
 
 #include "Utility.h"
+
+#else
+
+//The Utility Header, C++14 brings std::make_unique
+#define UTILITY_PORTABLE
+
+#include "Utility.h"
+#include "HeadlessTypes.h"
+
+#endif //BREAKIT_HEADLESS
 //#include "Globals.h"
\ No newline at end of file
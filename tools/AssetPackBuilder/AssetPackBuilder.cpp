@@ -0,0 +1,270 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+//NOTE: Offline tool that packs every asset the game loads through its ContentManager into one
+//		asset pack (see source/AssetPackFormat.h). The game maps the pack once at startup
+//		instead of opening a file per texture, font, map and sound bank.
+//
+//		AssetPackBuilder <package folder> <output pack> [-store]
+//
+//		Everything below <package folder>/Assets is packed under the name the game asks for,
+//		e.g. Assets\Textures\gui.dds. Entries are compressed when that saves at least an
+//		eighth, except sound banks which the game plays straight from the mapping. -store
+//		turns compression off. Music and loose .wav files are left out, Media Foundation
+//		streams and decodes them from their own files. Build the sound bank first.
+//		Builds with any C++17 compiler, e.g. g++ -std=c++17 -O2 AssetPackBuilder.cpp -o AssetPackBuilder
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../../source/AssetPackFormat.h"
+#include "../../source/AssetCompression.h"
+
+using namespace WinGame::Content;
+
+//Never read from the pack by the game
+const char *SkippedExtensions[] = { ".wma", ".wav" };
+
+//Used from the mapping as they are
+const char *StoredExtensions[] = { ".bank" };
+
+struct PackedAsset {
+	std::string					Name;
+	std::uint64_t				NameHash;
+	std::vector<std::uint8_t>	Data;		//As written to the pack
+	std::uint32_t				Size;
+	std::uint32_t				Flags;
+	std::uint64_t				Offset;
+};//PackedAsset struct
+
+static bool HasExtension( const std::filesystem::path &path, const char **extensions, std::size_t count ) {
+	std::string extension = path.extension().string();
+	std::transform( std::begin( extension ), std::end( extension ), std::begin( extension ), []( char c ) {
+		return static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) );
+	} );
+
+	return std::find( extensions, extensions + count, extension ) != extensions + count;
+}//HasExtension()
+
+//NOTE: The game hashes names as UTF-16, so the UTF-8 path is decoded into UTF-16 code units,
+//		one per wchar_t whatever its size. Returns false if name is not valid UTF-8.
+static bool Utf8ToUtf16( const std::string &name, std::wstring &units ) {
+	units.clear();
+
+	for ( std::size_t i = 0; i < name.size(); ) {
+		auto			lead	= static_cast<unsigned char>( name[i] );
+		std::uint32_t	code	= 0;
+		std::size_t		length	= 0;
+
+		if ( lead < 0x80 ) {
+			code	= lead;
+			length	= 1;
+		} else if ( lead >= 0xC2 && lead < 0xE0 ) {
+			code	= lead & 0x1F;
+			length	= 2;
+		} else if ( lead >= 0xE0 && lead < 0xF0 ) {
+			code	= lead & 0x0F;
+			length	= 3;
+		} else if ( lead >= 0xF0 && lead < 0xF5 ) {
+			code	= lead & 0x07;
+			length	= 4;
+		} else {
+			return false;
+		}
+
+		if ( name.size() - i < length ) {
+			return false;
+		}
+
+		for ( std::size_t j = 1; j < length; ++j ) {
+			auto trail = static_cast<unsigned char>( name[i + j] );
+
+			if ( ( trail & 0xC0 ) != 0x80 ) {
+				return false;
+			}
+
+			code = ( code << 6 ) | ( trail & 0x3F );
+		}
+
+		//Overlong forms, surrogates and anything past U+10FFFF
+		if ( ( length == 3 && code < 0x800 ) || ( length == 4 && code < 0x10000 ) || ( code >= 0xD800 && code < 0xE000 ) || code > 0x10FFFF ) {
+			return false;
+		}
+
+		if ( code < 0x10000 ) {
+			units.push_back( static_cast<wchar_t>( code ) );
+		} else {
+			code -= 0x10000;
+			units.push_back( static_cast<wchar_t>( 0xD800 + ( code >> 10 ) ) );
+			units.push_back( static_cast<wchar_t>( 0xDC00 + ( code & 0x3FF ) ) );
+		}
+
+		i += length;
+	}
+
+	return true;
+}//Utf8ToUtf16()
+
+static void WriteUInt( std::vector<unsigned char> &output, std::uint64_t value, std::uint32_t bytes ) {
+	for ( std::uint32_t i = 0; i < bytes; ++i ) {
+		output.push_back( static_cast<unsigned char>( ( value >> ( i * 8 ) ) & 0xFF ) );
+	}
+}//WriteUInt()
+
+static void Align( std::vector<unsigned char> &output ) {
+	while ( output.size() % AssetPackAlignment != 0 ) {
+		output.push_back( 0 );
+	}
+}//Align()
+
+int main( int argc, char **argv ) {
+	if ( argc < 3 || ( argc > 3 && std::strcmp( argv[3], "-store" ) != 0 ) ) {
+		std::fprintf( stderr, "Usage: AssetPackBuilder <package folder> <output pack> [-store]\n" );
+		return 1;
+	}
+
+	std::filesystem::path	root( argv[1] );
+	bool					compress = argc == 3;
+
+	if ( !std::filesystem::is_directory( root / "Assets" ) ) {
+		std::fprintf( stderr, "%s has no Assets folder\n", argv[1] );
+		return 1;
+	}
+
+	std::vector<PackedAsset>	assets;
+	std::uint64_t				totalSize = 0;
+
+	for ( const auto &item : std::filesystem::recursive_directory_iterator( root / "Assets" ) ) {
+		if ( !item.is_regular_file() || HasExtension( item.path(), SkippedExtensions, std::size( SkippedExtensions ) ) ) {
+			continue;
+		}
+
+		std::ifstream file( item.path(), std::ios::binary );
+
+		if ( !file.is_open() ) {
+			std::fprintf( stderr, "Could not read %s\n", item.path().string().c_str() );
+			return 1;
+		}
+
+		std::vector<std::uint8_t> data( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+
+		if ( data.size() > 0xFFFFFFFFULL ) {
+			std::fprintf( stderr, "%s is too large\n", item.path().string().c_str() );
+			return 1;
+		}
+
+		//The game asks with backslashes relative to the package folder
+		std::string		name = std::filesystem::relative( item.path(), root ).generic_u8string();
+		std::wstring	wideName;
+		std::replace( std::begin( name ), std::end( name ), '/', '\\' );
+
+		if ( !Utf8ToUtf16( name, wideName ) ) {
+			std::fprintf( stderr, "%s has no valid UTF-8 name\n", name.c_str() );
+			return 1;
+		}
+
+		PackedAsset asset;
+		asset.Name		= name;
+		asset.NameHash	= HashAssetName( wideName.c_str() );
+		asset.Size		= static_cast<std::uint32_t>( data.size() );
+		asset.Flags		= 0;
+		asset.Offset	= 0;
+
+		if ( compress && !data.empty() && !HasExtension( item.path(), StoredExtensions, std::size( StoredExtensions ) ) ) {
+			std::vector<std::uint8_t> packed;
+			CompressAsset( data.data(), data.size(), packed );
+
+			if ( packed.size() <= data.size() - data.size() / 8 ) {
+				data.swap( packed );
+				asset.Flags |= AssetPackCompressed;
+			}
+		}
+
+		asset.Data	= std::move( data );
+		totalSize	+= asset.Size;
+
+		assets.push_back( std::move( asset ) );
+	}
+
+	//The game looks assets up with a binary search over the hashes
+	std::sort( std::begin( assets ), std::end( assets ), []( const PackedAsset &left, const PackedAsset &right ) {
+		return left.NameHash < right.NameHash;
+	} );
+
+	for ( std::size_t i = 1; i < assets.size(); ++i ) {
+		if ( assets[i - 1].NameHash == assets[i].NameHash ) {
+			std::fprintf( stderr, "%s and %s have the same name hash\n", assets[i - 1].Name.c_str(), assets[i].Name.c_str() );
+			return 1;
+		}
+	}
+
+	//Lay the payloads out behind the header and the table of contents
+	std::uint64_t offset = sizeof( AssetPackHeader ) + assets.size() * sizeof( AssetPackEntry );
+
+	for ( auto &asset : assets ) {
+		offset			= ( offset + AssetPackAlignment - 1 ) / AssetPackAlignment * AssetPackAlignment;
+		asset.Offset	= offset;
+		offset			+= asset.Data.size();
+	}
+
+	std::vector<unsigned char> output;
+
+	WriteUInt( output, AssetPackMagic, 4 );
+	WriteUInt( output, AssetPackVersion, 4 );
+	WriteUInt( output, assets.size(), 4 );
+	WriteUInt( output, AssetPackAlignment, 4 );
+
+	for ( const auto &asset : assets ) {
+		WriteUInt( output, asset.NameHash, 8 );
+		WriteUInt( output, asset.Offset, 8 );
+		WriteUInt( output, asset.Data.size(), 4 );
+		WriteUInt( output, asset.Size, 4 );
+		WriteUInt( output, asset.Flags, 4 );
+		WriteUInt( output, 0, 4 );
+	}
+
+	for ( const auto &asset : assets ) {
+		Align( output );
+		output.insert( std::end( output ), std::begin( asset.Data ), std::end( asset.Data ) );
+
+		std::printf( "%-48s %10u -> %10u%s\n", asset.Name.c_str(), asset.Size, static_cast<std::uint32_t>( asset.Data.size() ), ( asset.Flags & AssetPackCompressed ) ? " compressed" : "" );
+	}
+
+	std::ofstream file( argv[2], std::ios::binary | std::ios::trunc );
+	file.write( reinterpret_cast<const char*>( output.data() ), output.size() );
+
+	if ( !file.good() ) {
+		std::fprintf( stderr, "Could not write %s\n", argv[2] );
+		return 1;
+	}
+
+	std::printf( "%u assets, %llu bytes packed into %u bytes written to %s\n", static_cast<std::uint32_t>( assets.size() ), static_cast<unsigned long long>( totalSize ), static_cast<std::uint32_t>( output.size() ), argv[2] );
+	return 0;
+}//main()
@@ -0,0 +1,986 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+//NOTE: Timing harness for the hot loops of the simulation, on the headless build.
+//		Every case does a fixed amount of work and prints its throughput and a checksum of
+//		the state it ended in, so two builds can be compared for speed and for doing the same work.
+//
+//		Benchmark [work per case, default 400000] [balls|kernel|bricks|items|load|memory, default all]
+//
+//		balls	BallManager::Update() of stress balls in a walled off level with eight rows
+//				of bricks, in balls moved per ms, at several ball counts. The work is in ball ticks.
+//		kernel	BrickHitBoxes::IsTouching() against four GameObject::IsTouchingBoxes() calls,
+//				in million box tests per s. The work is in tests of one box against four.
+//				Then ball queries against every brick of a full level, through the groups and
+//				brick by brick over std::shared_ptr<Brick> as before, in million bricks tested per s.
+//		bricks	BrickManager's grid against the BrickTree quadtree it replaced, ported below, on
+//				a few generated levels. Queries of random ball hitboxes in ns each (the work is
+//				in queries) and breaking every brick of the level one after the other in ns each.
+//		items	ItemManager::Update() of falling items in items per ms, at several item counts,
+//				and the walk of Draw() over the items keyed by a std::map as before against
+//				the arrays indexed by ITEM_TYPES. The work is in item ticks. Draw() itself needs
+//				a SpriteBatch, so the walk only builds the destination rects the sprites would get.
+//		load	Loads of a full 30x20 map through GameplayManager::Load() and BrickManager::AddBricks()
+//				alone, against building the quadtree one brick at a time as AddBrick() did before,
+//				in us per load. The work divided by 400 is the number of loads.
+//		memory	Heap bytes a full 30x20 level takes in BrickManager, in the grid of cells of
+//				std::shared_ptr<Brick> it kept before, and in the quadtree before that, counted
+//				through operator new, per brick.
+//				Every allocation of the harness carries a 16 byte header for that count.
+//
+//		Builds on the headless source files, e.g. from this directory
+//		g++ -std=c++14 -O2 -DBREAKIT_HEADLESS -I<DirectXMath>/Inc -I../../source -include pch.h
+//			Benchmark.cpp <headless sources of ../../source> -o Benchmark
+
+#include "pch.h"
+#include "BallManager.h"
+#include "BrickManager.h"
+#include "Player.h"
+#include "CollisionQueue.h"
+#include "BrickHitBoxes.h"
+#include "ItemManager.h"
+#include "GameplayManager.h"
+#include "Coin.h"
+#include "Random.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <new>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+using namespace DirectX;
+
+const float TickTime = 1.0f / DefaultTickRate;
+
+//Bytes currently allocated through operator new, the size is kept in front of every block
+static std::uint64_t liveBytes = 0;
+
+void* operator new( std::size_t size ) {
+	if ( auto memory = static_cast<std::uint8_t*>( std::malloc( size + 16 ) ) ) {
+		*reinterpret_cast<std::size_t*>( memory ) = size;
+		liveBytes += size;
+		return memory + 16;
+	}
+
+	throw std::bad_alloc();
+}//new()
+
+//NOTE: Kept out of line, g++ -Wall otherwise takes the inlined std::free() for a mismatch
+//		with the operator new of the caller.
+#if defined( __GNUC__ )
+__attribute__(( noinline ))
+#endif
+void operator delete( void *memory ) noexcept {
+	if ( memory ) {
+		auto block = static_cast<std::uint8_t*>( memory ) - 16;
+
+		liveBytes -= *reinterpret_cast<std::size_t*>( block );
+		std::free( block );
+	}
+}//delete()
+
+void operator delete( void *memory, std::size_t ) noexcept {
+	operator delete( memory );
+}//delete()
+
+//Rows of green bricks from the top, every other one left out if checkered. Eight full
+//rows are the built in level of HeadlessRunner.
+static std::vector<std::uint8_t> GetLevel( std::int32_t rows = 8, bool checkered = false ) {
+	std::vector<std::uint8_t> pixels( BricksWide * BricksHeigh * 4, 0 );
+
+	for ( std::int32_t cell = 0; cell < BricksWide * rows; ++cell ) {
+		if ( checkered && ( ( cell % BricksWide + cell / BricksWide ) & 1 ) != 0 ) {
+			continue;
+		}
+
+		pixels[cell * 4 + 1] = 255;
+		pixels[cell * 4 + 3] = 255;
+	}
+
+	return pixels;
+}//GetLevel()
+
+//NOTE: The wall and power level 0 are renewed every tick, so no ball is lost and no brick
+//		breaks, and every tick of a case does the same amount of work.
+static void BenchmarkBalls( std::uint32_t work ) {
+	const std::uint32_t counts[] = { 16, 64, 256, 1024, 4096 };
+
+	auto level = GetLevel();
+
+	std::printf( "balls       balls/ms   checksum\n" );
+
+	for ( auto count : counts ) {
+		BallManager		balls;
+		BrickManager	bricks;
+		CollisionQueue	events;
+
+		balls.Initialize( nullptr, false );
+		bricks.Initialize( nullptr, false );
+		bricks.AddBricks( level.data(), static_cast<std::uint32_t>( level.size() ) );
+
+		Player player( 0.0f, GameFieldHeight - PlayerTextureHeight - 42.0f, nullptr );
+		player.Position.x = GameFieldWidth * 0.5f + SplitterWidth - player.HitBoxSize.x * 0.5f;
+
+		balls.AddStressBalls( count );
+
+		std::uint32_t		ticks	= std::max<std::uint32_t>( work / count, 1U );
+		std::uint64_t		moved	= 0;
+		Utility::BasicTimer	timer;
+
+		for ( std::uint32_t tick = 0; tick < ticks; ++tick ) {
+			balls.ActivateWall();
+			balls.SetPowerLevel( 0 );
+
+			events.Reset();
+			balls.Update( &player, &bricks, nullptr, &events, TickTime, TickTime * static_cast<float>( tick ) );
+			moved += balls.GetCount();
+		}
+
+		timer.Update();
+
+		double checksum = 0.0;
+		for ( std::uint32_t i = 0; i < balls.GetCount(); ++i ) {
+			checksum += balls.GetBall( i )->Position.x + balls.GetBall( i )->Position.y * 3.0;
+		}
+
+		std::printf( "%5u %14.0f %10.6g\n", count, static_cast<double>( moved ) / ( timer.GetTotalTime() * 1000.0 ), checksum / count );
+	}
+}//BenchmarkBalls()
+
+//NOTE: The same ball hitboxes and brick groups go through both kernels. The checksum adds up
+//		the depths of all touching pairs, so it has to be the same for both rows.
+static void BenchmarkKernel( std::uint32_t work ) {
+	const std::uint32_t groupCount = 1024;
+
+	std::vector<BrickHitBoxes>	groups( groupCount );
+	std::vector<XMFLOAT2>		brickMins( groupCount * BoxLanes );
+	std::vector<XMFLOAT2>		brickMaxs( groupCount * BoxLanes );
+	std::vector<XMFLOAT2>		ballMins( groupCount );
+	std::vector<XMFLOAT2>		ballMaxs( groupCount );
+
+	//Every brick lies within 48 units of its ball, so about a third of the pairs touch
+	Random random;
+	random.Seed( 1, RANDOM_STREAM::ITEM_DROPS );
+
+	for ( std::uint32_t group = 0; group < groupCount; ++group ) {
+		ballMins[group] = XMFLOAT2( random.NextFloat() * GameFieldWidth, random.NextFloat() * MaximumBrickHeight );
+		ballMaxs[group] = XMFLOAT2( ballMins[group].x + BallWidth, ballMins[group].y + BallHeight );
+
+		for ( std::uint32_t lane = 0; lane < BoxLanes; ++lane ) {
+			XMFLOAT2 topLeft(
+				ballMins[group].x + ( random.NextFloat() * 2.0f - 1.0f ) * 48.0f,
+				ballMins[group].y + ( random.NextFloat() * 2.0f - 1.0f ) * 48.0f
+				);
+
+			groups[group].Push( lane, topLeft );
+			brickMins[group * BoxLanes + lane] = topLeft;
+			brickMaxs[group * BoxLanes + lane] = XMFLOAT2( topLeft.x + ItemWidth, topLeft.y + ItemHeight );
+		}
+	}
+
+	std::uint32_t rounds = std::max<std::uint32_t>( work / groupCount, 1U );
+
+	std::printf( "\nkernel     Mtests/s   checksum\n" );
+
+	{
+		double				checksum = 0.0;
+		Utility::BasicTimer	timer;
+
+		XMVECTOR	touching, depths, normalsX, normalsY;
+		XMUINT4		lanes;
+		XMFLOAT4	laneDepth;
+
+		for ( std::uint32_t round = 0; round < rounds; ++round ) {
+			for ( std::uint32_t group = 0; group < groupCount; ++group ) {
+				if ( !groups[group].IsTouching( XMLoadFloat2( &ballMins[group] ), XMLoadFloat2( &ballMaxs[group] ), touching, depths, normalsX, normalsY ) ) {
+					continue;
+				}
+
+				XMStoreUInt4( &lanes, touching );
+				XMStoreFloat4( &laneDepth, depths );
+
+				for ( std::uint32_t lane = 0; lane < BoxLanes; ++lane ) {
+					if ( ( &lanes.x )[lane] != 0 ) {
+						checksum += ( &laneDepth.x )[lane];
+					}
+				}
+			}
+		}
+
+		timer.Update();
+		std::printf( "four lane %10.1f %10.6g\n", static_cast<double>( rounds ) * groupCount * BoxLanes / ( timer.GetTotalTime() * 1.0e6 ), checksum / rounds );
+	}
+
+	{
+		double				checksum = 0.0;
+		Utility::BasicTimer	timer;
+
+		XMVECTOR depth, normal;
+
+		for ( std::uint32_t round = 0; round < rounds; ++round ) {
+			for ( std::uint32_t group = 0; group < groupCount; ++group ) {
+				auto ballMin = XMLoadFloat2( &ballMins[group] );
+				auto ballMax = XMLoadFloat2( &ballMaxs[group] );
+
+				for ( std::uint32_t lane = 0; lane < BoxLanes; ++lane ) {
+					auto brick = group * BoxLanes + lane;
+
+					if ( GameObject::IsTouchingBoxes( XMLoadFloat2( &brickMins[brick] ), XMLoadFloat2( &brickMaxs[brick] ), ballMin, ballMax, depth, normal ) ) {
+						checksum += XMVectorGetX( depth );
+					}
+				}
+			}
+		}
+
+		timer.Update();
+		std::printf( "scalar    %10.1f %10.6g\n", static_cast<double>( rounds ) * groupCount * BoxLanes / ( timer.GetTotalTime() * 1.0e6 ), checksum / rounds );
+	}
+}//BenchmarkKernel()
+
+//NOTE: A full level of 30x20 bricks walked one ball at a time, once through the groups of
+//		four the bricks are kept in now and once brick by brick over std::shared_ptr<Brick>
+//		with Brick::IsTouching(), as BrickTree::CheckCollision() did before the groups.
+//		Both checksums add up the depths of all touching pairs.
+static void BenchmarkKernelLevel( std::uint32_t work ) {
+	const std::uint32_t queryCount = 256;
+
+	std::vector<std::shared_ptr<Brick>>	bricks;
+	std::vector<BrickHitBoxes>			groups;
+	std::vector<GameObject>				balls;
+
+	for ( std::int32_t cell = 0; cell < BricksWide * BricksHeigh; ++cell ) {
+		auto brick = std::make_shared<Brick>( 0.0f, 0.0f, 1, nullptr );
+
+		brick->Position.x = SplitterWidth + static_cast<float>( cell % BricksWide ) * ItemWidth - brick->HitBoxOffset.x;
+		brick->Position.y = static_cast<float>( cell / BricksWide ) * ItemHeight - brick->HitBoxOffset.y;
+
+		if ( groups.empty() || groups.back().IsFull() ) {
+			groups.push_back( BrickHitBoxes() );
+		}
+
+		XMFLOAT2 topLeft;
+		XMStoreFloat2( &topLeft, brick->GetHitBoxTopLeft() );
+
+		groups.back().Push( static_cast<std::uint32_t>( cell ), topLeft );
+		bricks.push_back( brick );
+	}
+
+	Random random;
+	random.Seed( 1, RANDOM_STREAM::ITEM_DROPS );
+
+	for ( std::uint32_t i = 0; i < queryCount; ++i ) {
+		balls.push_back( GameObject(
+			SplitterWidth - BallWidth + random.NextFloat() * ( GameFieldWidth + BallWidth ),
+			-BallHeight + random.NextFloat() * ( MaximumBrickHeight + BallHeight ),
+			BallWidth,
+			BallHeight
+			) );
+	}
+
+	std::uint32_t	queries = std::max<std::uint32_t>( work / 64, 1U );
+	double			tests	= static_cast<double>( queries ) * bricks.size();
+
+	{
+		double				checksum = 0.0;
+		Utility::BasicTimer	timer;
+
+		XMVECTOR	touching, depths, normalsX, normalsY;
+		XMUINT4		lanes;
+		XMFLOAT4	laneDepth;
+
+		for ( std::uint32_t query = 0; query < queries; ++query ) {
+			const auto &ball	= balls[query % queryCount];
+			auto ballMin		= ball.GetHitBoxTopLeft();
+			auto ballMax		= ball.GetHitBoxBottomRight();
+
+			for ( const auto &group : groups ) {
+				if ( !group.IsTouching( ballMin, ballMax, touching, depths, normalsX, normalsY ) ) {
+					continue;
+				}
+
+				XMStoreUInt4( &lanes, touching );
+				XMStoreFloat4( &laneDepth, depths );
+
+				for ( std::uint32_t lane = 0; lane < group.Count; ++lane ) {
+					if ( ( &lanes.x )[lane] != 0 ) {
+						checksum += ( &laneDepth.x )[lane];
+					}
+				}
+			}
+		}
+
+		timer.Update();
+		std::printf( "level lanes %8.1f %10.6g\n", tests / ( timer.GetTotalTime() * 1.0e6 ), checksum / queries );
+	}
+
+	{
+		double				checksum = 0.0;
+		Utility::BasicTimer	timer;
+
+		XMVECTOR depth, normal;
+
+		for ( std::uint32_t query = 0; query < queries; ++query ) {
+			const auto &ball = balls[query % queryCount];
+
+			for ( const auto &brick : bricks ) {
+				if ( brick->IsVisible && brick->IsTouching( &ball, depth, normal ) ) {
+					checksum += XMVectorGetX( depth );
+				}
+			}
+		}
+
+		timer.Update();
+		std::printf( "level bricks %7.1f %10.6g\n", tests / ( timer.GetTotalTime() * 1.0e6 ), checksum / queries );
+	}
+}//BenchmarkKernelLevel()
+
+enum class BRICK_ADDITION : std::uint8_t {
+	ADD_FAILED = 0x00U,
+	ADD_SUCCEEDED,
+	ADD_OVERFLOW
+};//BrickAddition enum class
+
+//NOTE: The quadtree BrickManager kept its bricks in before the grid, cut down to what the
+//		collision of balls needs. Nodes hold up to 16 bricks and bricks that straddle the
+//		children stay in their parent. The hitboxes of a node are rebuilt into groups of four
+//		after every removal, as they were.
+class BrickTree : public GameObject {
+public:
+	std::unique_ptr<BrickTree> NorthWest;
+	std::unique_ptr<BrickTree> NorthEast;
+	std::unique_ptr<BrickTree> SouthWest;
+	std::unique_ptr<BrickTree> SouthEast;
+
+	std::vector<std::shared_ptr<Brick>>	Bricks;
+	std::vector<BrickHitBoxes>			HitBoxes;
+	bool								HitBoxesDirty;
+
+	BrickTree( float x, float y, float width, float height ) :
+		GameObject( x, y, width, height ),
+		HitBoxesDirty( false ) {
+	}//Ctor()
+
+	std::uint32_t GetBrickCount() const {
+		std::uint32_t result = static_cast<std::uint32_t>( Bricks.size() );
+
+		if ( NorthWest ) {
+			result += NorthWest->GetBrickCount();
+			result += NorthEast->GetBrickCount();
+			result += SouthWest->GetBrickCount();
+			result += SouthEast->GetBrickCount();
+		}
+
+		return result;
+	}//GetBrickCount()
+
+	BRICK_ADDITION Add( const std::shared_ptr<Brick> &brick ) {
+		XMVECTOR depth, normal;
+		XMVECTOR size = XMVectorSet( ItemWidth, ItemHeight, 0.0f, 1.0f );
+
+		if ( !IsTouching( brick.get(), depth, normal ) ) {
+			return BRICK_ADDITION::ADD_FAILED;
+		}
+
+		if ( XMVector2Less( depth, size ) ) {
+			return BRICK_ADDITION::ADD_OVERFLOW;
+		}
+
+		if ( !NorthWest && Bricks.size() <= 16 ) {
+			Insert( brick );
+			return BRICK_ADDITION::ADD_SUCCEEDED;
+		}
+
+		if ( !NorthWest ) {
+			Subdivide();
+		}
+
+		for ( auto child : { NorthWest.get(), SouthWest.get(), NorthEast.get(), SouthEast.get() } ) {
+			auto result = child->Add( brick );
+
+			if ( result == BRICK_ADDITION::ADD_OVERFLOW ) {
+				Insert( brick );
+				return BRICK_ADDITION::ADD_SUCCEEDED;
+			} else if ( result == BRICK_ADDITION::ADD_SUCCEEDED ) {
+				return BRICK_ADDITION::ADD_SUCCEEDED;
+			}
+		}
+
+		return BRICK_ADDITION::ADD_FAILED;
+	}//Add()
+
+	//Builds the hitbox groups of every node, which the tree otherwise does with the first query
+	void UpdateAllHitBoxes() {
+		UpdateHitBoxes();
+
+		if ( NorthWest ) {
+			NorthWest->UpdateAllHitBoxes();
+			NorthEast->UpdateAllHitBoxes();
+			SouthWest->UpdateAllHitBoxes();
+			SouthEast->UpdateAllHitBoxes();
+		}
+	}//UpdateAllHitBoxes()
+
+	void Insert( const std::shared_ptr<Brick> &brick ) {
+		Bricks.push_back( brick );
+		HitBoxesDirty = true;
+	}//Insert()
+
+	void Subdivide() {
+		float halfWidth		= Size.x * 0.5f;
+		float halfHeight	= Size.y * 0.5f;
+
+		NorthWest = std::make_unique<BrickTree>( Position.x, Position.y, halfWidth, halfHeight );
+		NorthEast = std::make_unique<BrickTree>( Position.x + halfWidth, Position.y, halfWidth, halfHeight );
+		SouthWest = std::make_unique<BrickTree>( Position.x, Position.y + halfHeight, halfWidth, halfHeight );
+		SouthEast = std::make_unique<BrickTree>( Position.x + halfWidth, Position.y + halfHeight, halfWidth, halfHeight );
+
+		decltype( Bricks ) overflow;
+
+		for ( auto &brick : Bricks ) {
+			for ( auto child : { NorthWest.get(), SouthWest.get(), NorthEast.get(), SouthEast.get() } ) {
+				auto result = child->Add( brick );
+
+				if ( result == BRICK_ADDITION::ADD_OVERFLOW ) {
+					overflow.push_back( brick );
+				}
+
+				if ( result != BRICK_ADDITION::ADD_FAILED ) {
+					break;
+				}
+			}
+		}
+
+		Bricks			= std::move( overflow );
+		HitBoxesDirty	= true;
+	}//Subdivide()
+
+	void UpdateHitBoxes() {
+		if ( !HitBoxesDirty ) {
+			return;
+		}
+
+		HitBoxes.assign( ( Bricks.size() + BoxLanes - 1 ) / BoxLanes, BrickHitBoxes() );
+
+		for ( decltype( Bricks.size() ) i = 0; i < Bricks.size(); ++i ) {
+			XMFLOAT2 topLeft;
+			XMStoreFloat2( &topLeft, Bricks[i]->GetHitBoxTopLeft() );
+
+			HitBoxes[i / BoxLanes].Push( static_cast<std::uint32_t>( i ), topLeft );
+		}
+
+		HitBoxesDirty = false;
+	}//UpdateHitBoxes()
+
+	bool CheckCollision( Ball *ball, CollisionQueue *events, XMVECTOR &correction, XMVECTOR &maxDepth, XMVECTOR &maxNormal ) {
+		bool touched	= false;
+		bool removed	= false;
+
+		XMVECTOR depth, normal;
+		XMVECTOR touching, depths, normalsX, normalsY;
+		XMVECTOR ballMin = ball->GetHitBoxTopLeft();
+		XMVECTOR ballMax = ball->GetHitBoxBottomRight();
+
+		XMUINT4		lanes;
+		XMFLOAT4	laneDepth;
+		XMFLOAT4	laneNormalX;
+		XMFLOAT4	laneNormalY;
+
+		UpdateHitBoxes();
+
+		for ( auto &group : HitBoxes ) {
+			if ( !group.IsTouching( ballMin, ballMax, touching, depths, normalsX, normalsY ) ) {
+				continue;
+			}
+
+			XMStoreUInt4( &lanes, touching );
+			XMStoreFloat4( &laneDepth, depths );
+			XMStoreFloat4( &laneNormalX, normalsX );
+			XMStoreFloat4( &laneNormalY, normalsY );
+
+			for ( std::uint32_t i = 0; i < group.Count; ++i ) {
+				auto &brick = Bricks[group.Cells[i]];
+
+				if ( ( &lanes.x )[i] == 0 || !brick->IsVisible ) {
+					continue;
+				}
+
+				depth	= XMVectorReplicate( ( &laneDepth.x )[i] );
+				normal	= XMVectorSet( ( &laneNormalX.x )[i], ( &laneNormalY.x )[i], 0.0f, 0.0f );
+
+				correction	= XMVectorAdd( correction, XMVectorMultiply( depth, normal ) );
+				touched		= true;
+
+				if ( XMVector2Greater( depth, maxDepth ) ) {
+					maxDepth	= depth;
+					maxNormal	= normal;
+				}
+
+				if ( brick->Health != 0 ) {
+					if ( ball->GetPower() >= brick->Health ) {
+						brick->Health = 0;
+					} else {
+						brick->Health -= ball->GetPower();
+					}
+				}
+
+				if ( brick->Health == 0 ) {
+					events->Push( COLLISION_EVENT::BRICK_BREAK, 0, brick->Points, brick->Position.x, brick->Position.y );
+					brick->IsVisible	= false;
+					removed				= true;
+				} else {
+					events->Push( COLLISION_EVENT::BRICK_HIT );
+				}
+			}
+		}
+
+		if ( removed ) {
+			Bricks.erase(
+				std::remove_if(
+					std::begin( Bricks ),
+					std::end( Bricks ),
+					[]( const std::shared_ptr<Brick> &brick ) { return !brick->IsVisible; }
+					),
+				std::end( Bricks )
+				);
+
+			HitBoxesDirty = true;
+		}
+
+		if ( NorthWest ) {
+			for ( auto child : { NorthWest.get(), NorthEast.get(), SouthWest.get(), SouthEast.get() } ) {
+				if ( child->IsTouching( ball ) ) {
+					touched |= child->CheckCollision( ball, events, correction, maxDepth, maxNormal );
+				}
+			}
+		}
+
+		return touched;
+	}//CheckCollision()
+
+};//BrickTree class
+
+//Puts the bricks of a level into a quadtree over the brick area of BrickManager
+static std::unique_ptr<BrickTree> GetTree( const std::vector<std::uint8_t> &level, const XMFLOAT2 &origin ) {
+	auto tree = std::make_unique<BrickTree>( origin.x, origin.y, GameFieldWidth, MaximumBrickHeight );
+
+	std::uint8_t health;
+	std::int32_t points;
+
+	for ( std::int32_t cell = 0; cell < BricksWide * BricksHeigh; ++cell ) {
+		if ( !Brick::PropertiesFromColor( level[cell * 4], level[cell * 4 + 1], level[cell * 4 + 2], health, points ) ) {
+			continue;
+		}
+
+		auto brick = std::make_shared<Brick>( 0.0f, 0.0f, health, nullptr );
+
+		brick->Position.x	= origin.x + static_cast<float>( cell % BricksWide ) * ItemWidth - brick->HitBoxOffset.x;
+		brick->Position.y	= origin.y + static_cast<float>( cell / BricksWide ) * ItemHeight - brick->HitBoxOffset.y;
+		brick->Points		= points;
+
+		if ( tree->Add( brick ) == BRICK_ADDITION::ADD_OVERFLOW ) {
+			tree->Insert( brick );
+		}
+	}
+
+	return tree;
+}//GetTree()
+
+//NOTE: Queries are made with a ball of power 0, so no brick breaks and every query of a level
+//		sees the same bricks. The checksum adds up where the balls end up after their bounces,
+//		so grid and tree have to agree on it. Breaking all bricks puts a ball of full power
+//		into every brick in turn, in the same shuffled order for both.
+static void BenchmarkBricks( std::uint32_t work ) {
+	struct BrickLevel {
+		const char	*Name;
+		std::int32_t	Rows;
+		bool			Checkered;
+	};//BrickLevel struct
+
+	const BrickLevel levels[] = {
+		{ "full",		BricksHeigh,	false },
+		{ "rows",		8,				false },
+		{ "checker",	BricksHeigh,	true }
+	};
+
+	std::printf( "\nbricks     query ns   checksum   break ns   checksum\n" );
+
+	for ( const auto &level : levels ) {
+		auto pixels = GetLevel( level.Rows, level.Checkered );
+
+		//Random ball positions all over the brick area and a shuffled order of the bricks
+		Random random;
+		random.Seed( 1, RANDOM_STREAM::ITEM_DROPS );
+
+		Ball ball( 0.0f, 0.0f, nullptr );
+
+		std::vector<XMFLOAT2>		positions( 4096 );
+		std::vector<std::uint32_t>	cells;
+
+		for ( auto &position : positions ) {
+			position.x = SplitterWidth - BallWidth + random.NextFloat() * ( GameFieldWidth + BallWidth ) - ball.HitBoxOffset.x;
+			position.y = -BallHeight + random.NextFloat() * ( MaximumBrickHeight + BallHeight ) - ball.HitBoxOffset.y;
+		}
+
+		for ( std::uint32_t cell = 0; cell < static_cast<std::uint32_t>( BricksWide * BricksHeigh ); ++cell ) {
+			if ( pixels[cell * 4 + 3] != 0 ) {
+				cells.push_back( cell );
+			}
+		}
+
+		for ( std::uint32_t i = static_cast<std::uint32_t>( cells.size() ); i > 1; --i ) {
+			std::swap( cells[i - 1], cells[random.NextBelow( i )] );
+		}
+
+		for ( std::uint32_t kind = 0; kind < 2; ++kind ) {
+			BrickManager	bricks;
+			CollisionQueue	events;
+
+			bricks.Initialize( nullptr, false );
+			bricks.AddBricks( pixels.data(), static_cast<std::uint32_t>( pixels.size() ) );
+
+			auto origin = bricks.GetGridOrigin();
+			auto tree	= GetTree( pixels, origin );
+
+			//Moves the ball into its place and runs it against the grid or the tree
+			auto query = [&]( XMFLOAT2 &position, XMFLOAT2 &velocity ) {
+				if ( kind == 0 ) {
+					bricks.CheckCollision( &ball, position, velocity, &events );
+					return;
+				}
+
+				XMVECTOR maxDepth	= XMVectorZero();
+				XMVECTOR maxNormal	= XMVectorZero();
+				XMVECTOR correction = XMVectorZero();
+
+				ball.Position = position;
+
+				if ( tree->IsTouching( &ball ) && tree->CheckCollision( &ball, &events, correction, maxDepth, maxNormal ) ) {
+					ball.Bounce( position, velocity, correction, maxDepth, maxNormal );
+				}
+			};//query lambda
+
+			double querySum = 0.0;
+			double breakSum = 0.0;
+
+			ball.SetPower( 0 );
+
+			Utility::BasicTimer queryTimer;
+
+			for ( std::uint32_t i = 0; i < work; ++i ) {
+				auto		position = positions[i & 4095];
+				XMFLOAT2	velocity( 0.0f, MinimumBallSpeed );
+
+				events.Clear();
+				query( position, velocity );
+
+				querySum += position.x + position.y * 3.0;
+			}
+
+			queryTimer.Update();
+
+			ball.SetPower( MaximumBrickHealth );
+			events.Reset();
+
+			Utility::BasicTimer breakTimer;
+
+			for ( auto cell : cells ) {
+				XMFLOAT2 position(
+					origin.x + static_cast<float>( cell % BricksWide ) * ItemWidth + ( ItemWidth - BallWidth ) * 0.5f - ball.HitBoxOffset.x,
+					origin.y + static_cast<float>( cell / BricksWide ) * ItemHeight + ( ItemHeight - BallHeight ) * 0.5f - ball.HitBoxOffset.y
+					);
+				XMFLOAT2 velocity( 0.0f, MinimumBallSpeed );
+
+				events.Clear();
+				query( position, velocity );
+			}
+
+			breakTimer.Update();
+			breakSum = static_cast<double>( events.GetTotal( COLLISION_EVENT::BRICK_BREAK ) );
+
+			std::printf(
+				"%-7s %4s %8.1f %10.6g %10.1f %10.6g\n",
+				level.Name,
+				kind == 0 ? "grid" : "tree",
+				queryTimer.GetTotalTime() * 1.0e9 / work,
+				querySum / work,
+				breakTimer.GetTotalTime() * 1.0e9 / cells.size(),
+				breakSum
+				);
+		}
+	}
+}//BenchmarkBricks()
+
+//NOTE: The player is moved off the field, so no item is collected and all of them keep
+//		falling for the 60 ticks of a round.
+static void BenchmarkItems( std::uint32_t work ) {
+	const std::uint32_t counts[]	= { 100, 300, 1000 };
+	const std::uint32_t roundTicks	= 60;
+
+	std::printf( "\nitems  update/ms  collected    map walk/ms  array walk/ms   checksum\n" );
+
+	for ( auto count : counts ) {
+		ItemManager	items;
+		Player		player( -1000.0f, -1000.0f, nullptr );
+
+		items.Initialize( nullptr, false );
+		items.SetSeed( 1 );
+
+		std::uint32_t	rounds	= std::max<std::uint32_t>( work / ( count * roundTicks ), 1U );
+		double			seconds	= 0.0;
+		Random			random;
+
+		random.Seed( 1, RANDOM_STREAM::ITEM_DROPS );
+
+		for ( std::uint32_t round = 0; round < rounds; ++round ) {
+			items.Clear();
+
+			for ( std::uint32_t i = 0; i < count; ++i ) {
+				items.AddItem( SplitterWidth + random.NextFloat() * ( GameFieldWidth - ItemWidth ), random.NextFloat() * MaximumBrickHeight * 0.5f );
+			}
+
+			Utility::BasicTimer timer;
+
+			for ( std::uint32_t tick = 0; tick < roundTicks; ++tick ) {
+				items.Update( &player, nullptr, nullptr, TickTime, TickTime * static_cast<float>( tick ) );
+			}
+
+			timer.Update();
+			seconds += timer.GetTotalTime();
+		}
+
+		//Items and frames once keyed by a map as before and once in arrays as now, with the same
+		//items in both. The walk does the per type lookup and per item rect of Draw().
+		std::map<ITEM_TYPES, std::vector<std::unique_ptr<Item>>>	itemMap;
+		std::map<ITEM_TYPES, RECT>									frameMap;
+		std::vector<std::unique_ptr<Item>>							itemArray[ItemTypeCount];
+		RECT														frameArray[ItemTypeCount];
+
+		for ( std::uint32_t type = 0; type < ItemTypeCount; ++type ) {
+			RECT frame = { static_cast<LONG>( type ) * 34, 0, static_cast<LONG>( type ) * 34 + 32, 32 };
+
+			frameMap[static_cast<ITEM_TYPES>( type )]	= frame;
+			frameArray[type]							= frame;
+		}
+
+		for ( std::uint32_t i = 0; i < count; ++i ) {
+			auto type	= random.NextBelow( ItemTypeCount );
+			auto x		= SplitterWidth + random.NextFloat() * ( GameFieldWidth - ItemWidth );
+			auto y		= random.NextFloat() * GameFieldHeight;
+
+			itemMap[static_cast<ITEM_TYPES>( type )].push_back( std::make_unique<Coin>( x, y, nullptr ) );
+			itemArray[type].push_back( std::make_unique<Coin>( x, y, nullptr ) );
+		}
+
+		std::uint32_t walks = std::max<std::uint32_t>( work / count, 1U );
+
+		auto drawRect = []( const Item *item, const RECT &frame ) {
+			RECT dest = {
+				Utility::ftoi( item->Position.x ),
+				Utility::ftoi( item->Position.y ),
+				Utility::ftoi( item->Position.x + item->Size.x ),
+				Utility::ftoi( item->Position.y + item->Size.y )
+			};
+
+			return static_cast<std::int64_t>( dest.left + dest.top + dest.right + dest.bottom + frame.left );
+		};//drawRect lambda
+
+		std::int64_t		mapSum = 0;
+		Utility::BasicTimer	mapTimer;
+
+		for ( std::uint32_t walk = 0; walk < walks; ++walk ) {
+			for ( auto &entry : itemMap ) {
+				const auto &frame = frameMap[entry.first];
+
+				for ( auto &item : entry.second ) {
+					mapSum += drawRect( item.get(), frame );
+				}
+			}
+		}
+
+		mapTimer.Update();
+
+		std::int64_t		arraySum = 0;
+		Utility::BasicTimer	arrayTimer;
+
+		for ( std::uint32_t walk = 0; walk < walks; ++walk ) {
+			for ( std::uint32_t type = 0; type < ItemTypeCount; ++type ) {
+				if ( itemArray[type].empty() ) {
+					continue;
+				}
+
+				const auto &frame = frameArray[type];
+
+				for ( auto &item : itemArray[type] ) {
+					arraySum += drawRect( item.get(), frame );
+				}
+			}
+		}
+
+		arrayTimer.Update();
+
+		std::printf(
+			"%5u %10.0f %10u %14.0f %14.0f %10lld\n",
+			count,
+			static_cast<double>( rounds ) * count * roundTicks / ( seconds * 1000.0 ),
+			items.GetCollectedCount(),
+			static_cast<double>( walks ) * count / ( mapTimer.GetTotalTime() * 1000.0 ),
+			static_cast<double>( walks ) * count / ( arrayTimer.GetTotalTime() * 1000.0 ),
+			static_cast<long long>( mapSum == arraySum ? arraySum / walks : -1 )
+			);
+	}
+}//BenchmarkItems()
+
+//NOTE: Unload() runs with every Load() of a loaded level and Clear() with every AddBricks()
+//		here, so they are part of the times. The checksum is the number of bricks loaded.
+static void BenchmarkLoad( std::uint32_t work ) {
+	auto			pixels	= GetLevel( BricksHeigh );
+	auto			length	= static_cast<std::uint32_t>( pixels.size() );
+	std::uint32_t	loads	= std::max<std::uint32_t>( work / 400, 1U );
+
+	std::printf( "\nload          us/load   checksum\n" );
+
+	{
+		GameplayManager game;
+		game.Initialize( false );
+		game.SetSeed( 1 );
+
+		Utility::BasicTimer timer;
+
+		for ( std::uint32_t i = 0; i < loads; ++i ) {
+			game.Load( pixels.data(), length );
+		}
+
+		timer.Update();
+		std::printf( "Load()      %10.2f %10u\n", timer.GetTotalTime() * 1.0e6 / loads, game.GetBricks()->GetCount() );
+	}
+
+	{
+		BrickManager bricks;
+		bricks.Initialize( nullptr, false );
+
+		Utility::BasicTimer timer;
+
+		for ( std::uint32_t i = 0; i < loads; ++i ) {
+			bricks.Clear();
+			bricks.AddBricks( pixels.data(), length );
+		}
+
+		timer.Update();
+		std::printf( "AddBricks() %10.2f %10u\n", timer.GetTotalTime() * 1.0e6 / loads, bricks.GetCount() );
+	}
+
+	{
+		XMFLOAT2			origin( SplitterWidth, 0.0f );
+		std::uint32_t		count = 0;
+		Utility::BasicTimer	timer;
+
+		for ( std::uint32_t i = 0; i < loads; ++i ) {
+			auto tree = GetTree( pixels, origin );
+			count = tree->GetBrickCount();
+		}
+
+		timer.Update();
+		std::printf( "tree        %10.2f %10u\n", timer.GetTotalTime() * 1.0e6 / loads, count );
+	}
+}//BenchmarkLoad()
+
+//NOTE: The tree is counted once its hitbox groups are built, as it was after the first
+//		frame of a level. Each count includes everything its build allocates.
+static void BenchmarkMemory() {
+	auto pixels = GetLevel( BricksHeigh );
+	auto before = liveBytes;
+
+	auto bricks = std::make_unique<BrickManager>();
+	bricks->Initialize( nullptr, false );
+	bricks->AddBricks( pixels.data(), static_cast<std::uint32_t>( pixels.size() ) );
+
+	auto			gridBytes	= liveBytes - before;
+	std::uint32_t	gridBricks	= bricks->GetCount();
+
+	before = liveBytes;
+
+	std::vector<std::shared_ptr<Brick>> cells( BricksWide * BricksHeigh );
+	std::uint8_t	health;
+	std::int32_t	points;
+	std::uint32_t	cellBricks = 0;
+
+	for ( std::int32_t cell = 0; cell < BricksWide * BricksHeigh; ++cell ) {
+		if ( Brick::PropertiesFromColor( pixels[cell * 4], pixels[cell * 4 + 1], pixels[cell * 4 + 2], health, points ) ) {
+			cells[cell] = std::make_shared<Brick>( 0.0f, 0.0f, health, nullptr );
+			++cellBricks;
+		}
+	}
+
+	auto cellBytes = liveBytes - before;
+
+	before = liveBytes;
+
+	auto tree = GetTree( pixels, bricks->GetGridOrigin() );
+	tree->UpdateAllHitBoxes();
+
+	auto			treeBytes	= liveBytes - before;
+	std::uint32_t	treeBricks	= tree->GetBrickCount();
+
+	std::printf( "\nmemory     bytes   bricks   bytes/brick\n" );
+	std::printf( "grid %10llu %8u %13.1f\n", static_cast<unsigned long long>( gridBytes ), gridBricks, static_cast<double>( gridBytes ) / gridBricks );
+	std::printf( "cells %9llu %8u %13.1f\n", static_cast<unsigned long long>( cellBytes ), cellBricks, static_cast<double>( cellBytes ) / cellBricks );
+	std::printf( "tree %10llu %8u %13.1f\n", static_cast<unsigned long long>( treeBytes ), treeBricks, static_cast<double>( treeBytes ) / treeBricks );
+	std::printf( "sizeof( Brick ) %u\n", static_cast<std::uint32_t>( sizeof( Brick ) ) );
+}//BenchmarkMemory()
+
+int main( int argc, char **argv ) {
+	std::uint32_t	work		= argc > 1 ? static_cast<std::uint32_t>( std::strtoul( argv[1], nullptr, 10 ) ) : 400000;
+	const char		*benchmark	= argc > 2 ? argv[2] : nullptr;
+
+	if ( !benchmark || std::strcmp( benchmark, "balls" ) == 0 ) {
+		BenchmarkBalls( work );
+	}
+
+	if ( !benchmark || std::strcmp( benchmark, "kernel" ) == 0 ) {
+		BenchmarkKernel( work );
+		BenchmarkKernelLevel( work );
+	}
+
+	if ( !benchmark || std::strcmp( benchmark, "bricks" ) == 0 ) {
+		BenchmarkBricks( work );
+	}
+
+	if ( !benchmark || std::strcmp( benchmark, "items" ) == 0 ) {
+		BenchmarkItems( work );
+	}
+
+	if ( !benchmark || std::strcmp( benchmark, "load" ) == 0 ) {
+		BenchmarkLoad( work );
+	}
+
+	if ( !benchmark || std::strcmp( benchmark, "memory" ) == 0 ) {
+		BenchmarkMemory();
+	}
+
+	return 0;
+}//main()
@@ -0,0 +1,216 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+//NOTE: Checks the closed form box against box collision of GameObject::IsTouching() against
+//		GJK/EPA (IsTouchingConvex()) on random rectangles. Both have to agree on whether the
+//		boxes touch, on the penetration depth and, where one axis is clearly the shallowest,
+//		on the normal. Afterwards GJK/EPA is run again on the same pairs while a replaced
+//		operator new counts allocations, a collision query must never touch the heap.
+//		Returns 0 if every pair agreed and nothing was allocated.
+//
+//		CollisionTest [pairs] [seed]
+//
+//		Pairs closer than Tolerance to just touching are skipped, there the two only differ
+//		in whether touching edges count. Builds on the headless source files, e.g.
+//		g++ -std=c++14 -O2 -DBREAKIT_HEADLESS -I<DirectXMath>/Inc -I../../source -include pch.h
+//			CollisionTest.cpp ../../source/GameObject.cpp ../../source/GJK.cpp -o CollisionTest
+
+#include "pch.h"
+#include "GameObject.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cfloat>
+#include <new>
+
+using namespace BreakIt::Objects;
+using namespace DirectX;
+
+//EPA stops once an edge is closer than sqrt(epsilon) to the support point
+const float Tolerance = 1.0e-3f;
+
+//Pairs kept for the allocation check
+const std::uint32_t AllocationPairs = 10000;
+
+static std::uint64_t allocationCount = 0;
+
+void* operator new( std::size_t size ) {
+	++allocationCount;
+
+	if ( auto memory = std::malloc( size > 0 ? size : 1 ) ) {
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}//new()
+
+void operator delete( void *memory ) noexcept {
+	std::free( memory );
+}//delete()
+
+void operator delete( void *memory, std::size_t ) noexcept {
+	std::free( memory );
+}//delete()
+
+struct Comparison {
+	std::uint32_t	Pairs;
+	std::uint32_t	Skipped;
+	std::uint32_t	Touching;
+	std::uint32_t	NormalsCompared;
+	std::uint32_t	HitMismatches;
+	std::uint32_t	DepthMismatches;
+	std::uint32_t	NormalMismatches;
+	float			LargestDepthError;
+};//Comparison struct
+
+static GameObject RandomBox( std::mt19937 &random ) {
+	std::uniform_real_distribution<float> position( -300.0f, 300.0f );
+	std::uniform_real_distribution<float> size( 1.0f, 200.0f );
+
+	GameObject box( position( random ), position( random ), size( random ), size( random ) );
+	box.HitBoxOffset = XMFLOAT2( position( random ) * 0.05f, position( random ) * 0.05f );
+	box.HitBoxSize	 = XMFLOAT2( size( random ), size( random ) );
+
+	return box;
+}//RandomBox()
+
+//Overlap along the four axis directions, the smallest is the penetration depth
+static void GetOverlaps( const GameObject &a, const GameObject &b, float overlaps[4] ) {
+	XMFLOAT2 aMin, aMax, bMin, bMax;
+	XMStoreFloat2( &aMin, a.GetHitBoxTopLeft() );
+	XMStoreFloat2( &aMax, a.GetHitBoxBottomRight() );
+	XMStoreFloat2( &bMin, b.GetHitBoxTopLeft() );
+	XMStoreFloat2( &bMax, b.GetHitBoxBottomRight() );
+
+	overlaps[0] = aMax.x - bMin.x;
+	overlaps[1] = bMax.x - aMin.x;
+	overlaps[2] = aMax.y - bMin.y;
+	overlaps[3] = bMax.y - aMin.y;
+}//GetOverlaps()
+
+int main( int argc, char **argv ) {
+	std::uint32_t pairs	= argc > 1 ? static_cast<std::uint32_t>( std::strtoul( argv[1], nullptr, 10 ) ) : 1000000;
+	std::uint32_t seed	= argc > 2 ? static_cast<std::uint32_t>( std::strtoul( argv[2], nullptr, 10 ) ) : 1;
+
+	std::mt19937	random( seed );
+	Comparison		result = {};
+
+	std::vector<GameObject> kept;
+	kept.reserve( AllocationPairs * 2 );
+
+	for ( std::uint32_t i = 0; i < pairs; ++i ) {
+		auto a = RandomBox( random );
+		auto b = RandomBox( random );
+
+		//Every fourth pair is moved into the other box so that most of them overlap
+		if ( i % 4 != 0 ) {
+			b.Position.x = a.Position.x + ( b.Position.x - a.Position.x ) * 0.1f;
+			b.Position.y = a.Position.y + ( b.Position.y - a.Position.y ) * 0.1f;
+		}
+
+		++result.Pairs;
+
+		if ( kept.size() < kept.capacity() ) {
+			kept.push_back( a );
+			kept.push_back( b );
+		}
+
+		float overlaps[4];
+		GetOverlaps( a, b, overlaps );
+
+		auto shallowest = std::min_element( overlaps, overlaps + 4 );
+
+		if ( std::fabs( *shallowest ) < Tolerance ) {
+			++result.Skipped;
+			continue;
+		}
+
+		XMVECTOR boxDepth, boxNormal, convexDepth, convexNormal;
+		bool boxHit		= a.IsTouching( &b, boxDepth, boxNormal );
+		bool convexHit	= a.IsTouchingConvex( &b, convexDepth, convexNormal );
+
+		if ( boxHit != convexHit || boxHit != a.IsTouching( &b ) || convexHit != a.IsTouchingConvex( &b ) ) {
+			++result.HitMismatches;
+			continue;
+		}
+
+		if ( !boxHit ) {
+			continue;
+		}
+
+		++result.Touching;
+
+		float error = std::fabs( XMVectorGetX( boxDepth ) - XMVectorGetX( convexDepth ) );
+		result.LargestDepthError = std::max<float>( result.LargestDepthError, error );
+
+		if ( error > Tolerance * std::max<float>( 1.0f, XMVectorGetX( boxDepth ) ) ) {
+			++result.DepthMismatches;
+		}
+
+		//With two axes about as shallow either normal is right
+		float second = FLT_MAX;
+
+		for ( auto overlap = overlaps; overlap != overlaps + 4; ++overlap ) {
+			if ( overlap != shallowest ) {
+				second = std::min<float>( second, *overlap );
+			}
+		}
+
+		if ( second - *shallowest < 0.01f ) {
+			continue;
+		}
+
+		++result.NormalsCompared;
+
+		if ( XMVectorGetX( XMVector2Dot( boxNormal, convexNormal ) ) < 0.9999f ) {
+			++result.NormalMismatches;
+		}
+	}
+
+	std::printf( "%u pairs, %u skipped as just touching, %u touching, %u normals compared\n", result.Pairs, result.Skipped, result.Touching, result.NormalsCompared );
+	std::printf( "%u hit, %u depth and %u normal mismatches, largest depth difference %g\n", result.HitMismatches, result.DepthMismatches, result.NormalMismatches, result.LargestDepthError );
+
+	//The counter has to see allocations at all, or no allocations below would prove nothing
+	auto before = allocationCount;
+	std::vector<int> probe( 1 );
+
+	if ( allocationCount == before ) {
+		std::printf( "operator new is not counted\n" );
+		return 1;
+	}
+
+	std::uint32_t	hits = 0;
+	XMVECTOR		depth, normal;
+
+	before = allocationCount;
+
+	for ( std::size_t i = 0; i + 1 < kept.size(); i += 2 ) {
+		hits += kept[i].IsTouchingConvex( &kept[i + 1] ) ? 1 : 0;
+		hits += kept[i].IsTouchingConvex( &kept[i + 1], depth, normal ) ? 1 : 0;
+	}
+
+	auto allocations = allocationCount - before;
+	std::printf( "%u GJK/EPA queries, %u hits, %llu allocations\n", static_cast<std::uint32_t>( kept.size() ), hits, static_cast<unsigned long long>( allocations ) );
+
+	return result.HitMismatches + result.DepthMismatches + result.NormalMismatches == 0 && allocations == 0 ? 0 : 1;
+}//main()
@@ -0,0 +1,196 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+//NOTE: Chi-square test of the item drops. Draws from an AliasTable over the ItemDropWeights of
+//		Globals.h, and over a few other weight sets, on the ITEM_DROPS stream of several seeds
+//		and compares how often every index came up with what its weight asks for. Also checks
+//		that the probabilities the table was built to give match the weights, and that an
+//		index of weight 0 never comes up. Returns 0 if every run passed.
+//
+//		DropTest [draws per run] [seeds]
+//
+//		A run fails if its chi-square value is more unlikely than Significance. The seeds are
+//		fixed, so a passing build keeps passing. Builds on its own, e.g. from this directory
+//		g++ -std=c++14 -O2 -DBREAKIT_HEADLESS -I<DirectXMath>/Inc -I../../source -include pch.h
+//			DropTest.cpp ../../source/Random.cpp -o DropTest
+
+#include "pch.h"
+#include "Globals.h"
+#include "Random.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cfloat>
+#include <vector>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+
+const double Significance	= 0.001;
+const double Deviation		= 1.0e-9;
+
+struct WeightSet {
+	const char			*Name;
+	std::vector<double>	Weights;
+};//WeightSet struct
+
+//Regularized upper incomplete gamma function Q(a, x), the chance of a chi-square value of at
+//least 2x with 2a degrees of freedom. Series below a + 1, continued fraction above.
+static double GammaQ( double a, double x ) {
+	if ( x <= 0.0 ) {
+		return 1.0;
+	}
+
+	double prefix = std::exp( a * std::log( x ) - x - std::lgamma( a ) );
+
+	if ( x < a + 1.0 ) {
+		double term = 1.0 / a;
+		double sum	= term;
+
+		for ( double n = 1.0; n < 1000.0 && term > sum * 1.0e-15; n += 1.0 ) {
+			term	*= x / ( a + n );
+			sum		+= term;
+		}
+
+		return std::max<double>( 1.0 - sum * prefix, 0.0 );
+	}
+
+	double b = x + 1.0 - a;
+	double c = 1.0 / DBL_MIN;
+	double d = 1.0 / b;
+	double h = d;
+
+	for ( double n = 1.0; n < 1000.0; n += 1.0 ) {
+		double an = -n * ( n - a );
+		b += 2.0;
+
+		d = an * d + b;
+		d = std::fabs( d ) < DBL_MIN ? DBL_MIN : d;
+		c = b + an / c;
+		c = std::fabs( c ) < DBL_MIN ? DBL_MIN : c;
+		d = 1.0 / d;
+
+		h *= d * c;
+
+		if ( std::fabs( d * c - 1.0 ) < 1.0e-15 ) {
+			break;
+		}
+	}
+
+	return prefix * h;
+}//GammaQ()
+
+int main( int argc, char **argv ) {
+	std::uint32_t draws = argc > 1 ? static_cast<std::uint32_t>( std::strtoul( argv[1], nullptr, 10 ) ) : 10000000;
+	std::uint32_t seeds = argc > 2 ? static_cast<std::uint32_t>( std::strtoul( argv[2], nullptr, 10 ) ) : 5;
+
+	const WeightSet sets[] = {
+		{ "items",		std::vector<double>( ItemDropWeights, ItemDropWeights + ItemTypeCount ) },
+		{ "uniform",	std::vector<double>( 12, 1.0 ) },
+		{ "zero",		{ 1.0, 0.0, 3.0, 0.5, 0.0 } },
+		{ "skewed",		{ 5000.0, 1.0, 2.0, 3.0, 5000.0 } }
+	};
+
+	std::uint32_t failed = 0;
+
+	std::printf( "set       indices   deviation   worst chi2 / df    smallest p\n" );
+
+	for ( const auto &set : sets ) {
+		AliasTable table;
+		table.Build( set.Weights );
+
+		double sum = 0.0;
+		for ( auto weight : set.Weights ) {
+			sum += weight;
+		}
+
+		double deviation = 0.0;
+		for ( std::uint32_t i = 0; i < table.GetCount(); ++i ) {
+			deviation = std::max<double>( deviation, std::fabs( table.GetProbability( i ) - set.Weights[i] / sum ) );
+		}
+
+		double			worstChiSquare	= 0.0;
+		double			smallestP		= 1.0;
+		std::uint32_t	freedom			= 0;
+		std::uint64_t	impossible		= 0;
+
+		for ( std::uint32_t seed = 1; seed <= seeds; ++seed ) {
+			Random random;
+			random.Seed( seed, RANDOM_STREAM::ITEM_DROPS );
+
+			std::vector<std::uint64_t> counts( table.GetCount(), 0 );
+
+			for ( std::uint32_t i = 0; i < draws; ++i ) {
+				++counts[table.Sample( random )];
+			}
+
+			//Indices of weight 0 are left out of the test, they must not come up at all
+			double chiSquare = 0.0;
+			freedom = 0;
+
+			for ( std::uint32_t i = 0; i < table.GetCount(); ++i ) {
+				if ( set.Weights[i] <= 0.0 ) {
+					impossible += counts[i];
+					continue;
+				}
+
+				double expected = static_cast<double>( draws ) * set.Weights[i] / sum;
+				double error	= static_cast<double>( counts[i] ) - expected;
+
+				chiSquare += error * error / expected;
+				++freedom;
+			}
+
+			freedom -= 1;
+
+			double p = GammaQ( freedom * 0.5, chiSquare * 0.5 );
+
+			worstChiSquare	= std::max<double>( worstChiSquare, chiSquare );
+			smallestP		= std::min<double>( smallestP, p );
+		}
+
+		bool passed = deviation <= Deviation && impossible == 0 && smallestP >= Significance;
+
+		std::printf(
+			"%-8s %8u %11.3g %10.2f / %-4u %12.4f%s\n",
+			set.Name,
+			table.GetCount(),
+			deviation,
+			worstChiSquare,
+			freedom,
+			smallestP,
+			passed ? "" : "  FAILED"
+			);
+
+		if ( impossible != 0 ) {
+			std::printf( "%llu draws of an index of weight 0\n", static_cast<unsigned long long>( impossible ) );
+		}
+
+		if ( !passed ) {
+			++failed;
+		}
+	}
+
+	std::printf( "%u draws on %u seeds per set, %u of %u sets failed\n", draws, seeds, failed, static_cast<std::uint32_t>( sizeof( sets ) / sizeof( sets[0] ) ) );
+	return failed == 0 ? 0 : 1;
+}//main()
@@ -0,0 +1,435 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+//NOTE: Runs the headless simulation (see the README) from the command line, on any platform.
+//		Plays a batch of Autopilot games of one level and prints the summary, or the batch
+//		throughput at every thread count from 1 up to the number of hardware threads.
+//
+//		HeadlessRunner [-level map.bmp] [-games n] [-seed n] [-threads n] [-ticks n] [-scaling]
+//		HeadlessRunner [-level map.bmp] [-seed n] -wav output.wav <asset folder>
+//		HeadlessRunner [-level map.bmp] [-seed n] [-ticks n] -rewind
+//		HeadlessRunner [-level map.bmp] [-ticks n] -replay
+//
+//		Without -level a built in level of eight rows is played. -wav plays the one game of
+//		-seed through the software mixer into a .wav file, with the BasicStyle sounds read
+//		from below the asset folder. -rewind plays that game with and without rewind and
+//		prints what the history costs per tick and per second, then rewinds it tick by tick
+//		back to the start and prints how long a restore takes. -replay records a game without
+//		a seed and checks that the recording replays to the same end. Builds on the headless set of source files, e.g.
+//		g++ -std=c++14 -O2 -pthread -DBREAKIT_HEADLESS -I<DirectXMath>/Inc -I../../source
+//			-include pch.h HeadlessRunner.cpp <headless files from ../../source> -o HeadlessRunner
+
+#include "pch.h"
+#include "BatchSimulator.h"
+#include "Autopilot.h"
+#include "AudioOutputs.h"
+#include "BasicStyle.h"
+#include "Globals.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+using namespace BreakIt::Styles;
+using namespace WinGame::Audio;
+
+static std::uint32_t ReadUInt( const std::vector<unsigned char> &data, std::size_t offset, std::uint32_t bytes ) {
+	std::uint32_t value = 0;
+
+	for ( std::uint32_t i = 0; i < bytes; ++i ) {
+		value |= static_cast<std::uint32_t>( data[offset + i] ) << ( i * 8 );
+	}
+
+	return value;
+}//ReadUInt()
+
+//NOTE: Reads an uncompressed 24 or 32 bit map .bmp into rows of 4 bytes per pixel, top row
+//		first, in the byte order BitmapDecoder hands the game (blue, green, red, alpha).
+static bool LoadMap( const std::string &filename, std::vector<std::uint8_t> &pixels ) {
+	std::ifstream file( filename, std::ios::binary );
+
+	if ( !file ) {
+		return false;
+	}
+
+	std::vector<unsigned char> data( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+
+	if ( data.size() < 54 || data[0] != 'B' || data[1] != 'M' ) {
+		return false;
+	}
+
+	auto offset		= ReadUInt( data, 10, 4 );
+	auto width		= static_cast<std::int32_t>( ReadUInt( data, 18, 4 ) );
+	auto height		= static_cast<std::int32_t>( ReadUInt( data, 22, 4 ) );
+	auto bits		= ReadUInt( data, 28, 2 );
+	auto compressed	= ReadUInt( data, 30, 4 );
+	bool bottomUp	= height > 0;
+
+	height = std::abs( height );
+
+	//32 bit maps may be saved as BI_BITFIELDS, the usual masks give the same layout
+	if ( width <= 0 || ( bits != 24 && bits != 32 ) || ( compressed != 0 && compressed != 3 ) ) {
+		return false;
+	}
+
+	std::size_t stride = ( static_cast<std::size_t>( width ) * bits / 8 + 3 ) & ~static_cast<std::size_t>( 3 );
+
+	if ( offset + stride * height > data.size() ) {
+		return false;
+	}
+
+	pixels.resize( static_cast<std::size_t>( width ) * height * 4 );
+
+	for ( std::int32_t y = 0; y < height; ++y ) {
+		auto row = &data[offset + stride * ( bottomUp ? height - 1 - y : y )];
+		auto out = &pixels[static_cast<std::size_t>( y ) * width * 4];
+
+		for ( std::int32_t x = 0; x < width; ++x, row += bits / 8, out += 4 ) {
+			out[0] = row[0];
+			out[1] = row[1];
+			out[2] = row[2];
+			out[3] = bits == 32 ? row[3] : 255;
+		}
+	}
+
+	return true;
+}//LoadMap()
+
+//Eight rows, green bricks with a stronger one every third cell
+static std::vector<std::uint8_t> GetDefaultMap() {
+	std::vector<std::uint8_t> pixels( BricksWide * BricksHeigh * 4, 0 );
+
+	for ( std::int32_t cell = 0; cell < BricksWide * 8; ++cell ) {
+		pixels[cell * 4 + 1] = 255;
+		pixels[cell * 4 + 3] = 255;
+
+		if ( cell % 3 == 0 ) {
+			pixels[cell * 4] = 255;
+		}
+	}
+
+	return pixels;
+}//GetDefaultMap()
+
+static void PrintSummary( const BatchSummary &summary, std::uint32_t threads ) {
+	std::printf( "%u games, %u won, %llu ticks on %u threads\n", summary.Games, summary.Wins, static_cast<unsigned long long>( summary.Ticks ), threads );
+	std::printf( "clear time %.1f s, lives lost %.2f, points %.1f, items %.2f\n", summary.AverageClearTime, summary.AverageLivesLost, summary.AveragePoints, summary.AverageItemsCollected );
+	std::printf( "%.0f ticks/s\n", summary.TicksPerSecond );
+}//PrintSummary()
+
+static int RecordGame( const std::vector<std::uint8_t> &map, std::uint32_t seed, const std::string &wave, const std::string &root ) {
+	Mixer mixer;
+
+	if ( !mixer.SetOutput( std::unique_ptr<IAudioOutput>( new WaveFileOutput( wave ) ) ) ) {
+		std::fprintf( stderr, "Could not write %s\n", wave.c_str() );
+		return 1;
+	}
+
+	BasicStyle		style;
+	GameplayManager	game;
+	Autopilot		autopilot;
+	const float		tickTime = 1.0f / DefaultTickRate;
+
+	game.Initialize( false, &mixer, &style, root );
+	game.SetSeed( seed );
+	game.Load( map.data(), static_cast<std::uint32_t>( map.size() ) );
+
+	std::uint32_t tick = 0;
+
+	for ( ; tick < BatchMaximumTicks && !game.IsGameWon() && !game.IsGameLost(); ++tick ) {
+		if ( game.IsGamePaused() ) {
+			game.SetPause( false );
+		}
+
+		game.Update( autopilot.GetPlayerDelta( &game, tickTime ), tickTime, tickTime * static_cast<float>( tick ) );
+	}
+
+	mixer.GetOutput()->Close();
+
+	auto sounds = game.GetSounds();
+	std::printf( "%u ticks, %s, %llu frames mixed into %s\n", tick, game.IsGameWon() ? "won" : "not won", static_cast<unsigned long long>( mixer.GetMixedFrames() ), wave.c_str() );
+	std::printf( "%llu plays coalesced, %llu voices stolen, %llu plays dropped\n",
+		static_cast<unsigned long long>( sounds->GetCoalescedCount() ),
+		static_cast<unsigned long long>( sounds->GetStealCount() ),
+		static_cast<unsigned long long>( sounds->GetDroppedCount() ) );
+	return 0;
+}//RecordGame()
+
+//Plays the game of seed and returns the seconds spent in Update()
+static float PlayGame( GameplayManager &game, const std::vector<std::uint8_t> &map, std::uint32_t seed, std::uint32_t ticks, std::uint32_t &played ) {
+	Autopilot	autopilot;
+	const float	tickTime = 1.0f / DefaultTickRate;
+	float		time	 = 0.0f;
+
+	game.SetSeed( seed );
+	game.Load( map.data(), static_cast<std::uint32_t>( map.size() ) );
+
+	for ( played = 0; played < ticks && !game.IsGameWon() && !game.IsGameLost(); ++played ) {
+		if ( game.IsGamePaused() ) {
+			game.SetPause( false );
+		}
+
+		auto delta = autopilot.GetPlayerDelta( &game, tickTime );
+
+		Utility::BasicTimer timer;
+		game.Update( delta, tickTime, tickTime * static_cast<float>( played ) );
+		timer.Update();
+		time += timer.GetTotalTime();
+	}
+
+	return time;
+}//PlayGame()
+
+//NOTE: The history is kept without a budget here, so the memory use covers the whole game.
+//		Restores go back one tick at a time, which passes every distance from a keyframe.
+static int MeasureRewind( const std::vector<std::uint8_t> &map, std::uint32_t seed, std::uint32_t ticks ) {
+	const float tickTime = 1.0f / DefaultTickRate;
+
+	GameplayManager	plain, rewound;
+	std::uint32_t	plainTicks, rewoundTicks;
+
+	plain.Initialize( false );
+	rewound.Initialize( false );
+	rewound.EnableRewind( 0xFFFFFFFFU, RewindKeyframeInterval );
+
+	float plainTime		= PlayGame( plain, map, seed, ticks, plainTicks );
+	float rewoundTime	= PlayGame( rewound, map, seed, ticks, rewoundTicks );
+
+	if ( plainTicks != rewoundTicks || rewoundTicks == 0 ) {
+		std::fprintf( stderr, "The game played differently with rewind, %u against %u ticks\n", rewoundTicks, plainTicks );
+		return 1;
+	}
+
+	//The part of the cost that is serializing the level, the rest is the delta and its storage
+	const std::uint32_t	saves = 10000;
+	std::vector<std::uint8_t> snapshot;
+
+	Utility::BasicTimer saveTimer;
+	for ( std::uint32_t i = 0; i < saves; ++i ) {
+		rewound.SaveState( snapshot );
+	}
+	saveTimer.Update();
+
+	auto	buffer			= rewound.GetRewindBuffer();
+	float	seconds			= static_cast<float>( rewoundTicks ) * tickTime;
+	float	bytesPerSecond	= static_cast<float>( buffer->GetMemoryUsage() ) / seconds;
+
+	std::printf( "%u ticks (%.1f s of play), snapshots of %u bytes, a keyframe every %u ticks\n", rewoundTicks, seconds, static_cast<std::uint32_t>( snapshot.size() ), RewindKeyframeInterval );
+	std::printf( "update %.2f us/tick without rewind, %.2f us/tick with it (+%.2f us)\n",
+		plainTime * 1.0e6f / static_cast<float>( plainTicks ),
+		rewoundTime * 1.0e6f / static_cast<float>( rewoundTicks ),
+		( rewoundTime - plainTime ) * 1.0e6f / static_cast<float>( rewoundTicks ) );
+	std::printf( "of which %.2f us/tick are SaveState()\n", saveTimer.GetTotalTime() * 1.0e6f / static_cast<float>( saves ) );
+	std::printf( "history %u bytes, %.1f kB per second, %.0f s fit into the default %u kB\n",
+		buffer->GetMemoryUsage(),
+		bytesPerSecond / 1024.0f,
+		static_cast<float>( RewindMemoryBudget ) / bytesPerSecond,
+		RewindMemoryBudget / 1024 );
+
+	float			restoreTime	= 0.0f;
+	float			slowest		= 0.0f;
+	std::uint32_t	restores	= 0;
+
+	while ( buffer->GetLastTick() > buffer->GetFirstTick() ) {
+		Utility::BasicTimer timer;
+
+		if ( !rewound.RewindTo( buffer->GetLastTick() - 1 ) ) {
+			std::fprintf( stderr, "Rewind to tick %u failed\n", buffer->GetLastTick() - 1 );
+			return 1;
+		}
+
+		timer.Update();
+		restoreTime += timer.GetTotalTime();
+		slowest		= std::max<float>( slowest, timer.GetTotalTime() );
+		++restores;
+	}
+
+	std::printf( "%u restores, %.2f us on average, %.2f us at most\n", restores, restoreTime * 1.0e6f / static_cast<float>( std::max<std::uint32_t>( restores, 1U ) ), slowest * 1.0e6f );
+	return 0;
+}//MeasureRewind()
+
+//Plays the loaded level with the Autopilot until it ends or after ticks, tick counts from Load()
+static std::uint32_t PlayLevel( GameplayManager &game, std::uint32_t ticks ) {
+	Autopilot		autopilot;
+	const float		tickTime	= 1.0f / DefaultTickRate;
+	std::uint32_t	played		= 0;
+
+	for ( ; played < ticks && !game.IsGameWon() && !game.IsGameLost(); ++played ) {
+		if ( game.IsGamePaused() ) {
+			game.SetPause( false );
+		}
+
+		game.Update( autopilot.GetPlayerDelta( &game, tickTime ), tickTime, tickTime * static_cast<float>( played ) );
+	}
+
+	return played;
+}//PlayLevel()
+
+//NOTE: Records a game without a seed, after a first attempt at the level that already drew
+//		item drops, and plays the recording back in a new GameplayManager. Points and lives
+//		carry over from the first attempt into the recorded one, so the two are compared by
+//		what happened in the level: ticks, bricks left, points won, lives lost and where the paddle ended.
+static int CheckReplay( const std::vector<std::uint8_t> &map, std::uint32_t ticks ) {
+	const float tickTime = 1.0f / DefaultTickRate;
+
+	GameplayManager recorded, replayed;
+	recorded.Initialize( false );
+	replayed.Initialize( false );
+
+	recorded.StartRecording( tickTime );
+	recorded.Load( map.data(), static_cast<std::uint32_t>( map.size() ) );
+	PlayLevel( recorded, 600 );
+
+	recorded.Load( map.data(), static_cast<std::uint32_t>( map.size() ) );
+	auto played = PlayLevel( recorded, ticks );
+
+	auto replay			= recorded.GetReplay();
+	auto replayedTicks	= replay->Play( &replayed, map.data(), static_cast<std::uint32_t>( map.size() ) );
+
+	GameplayManager		*games[] = { &recorded, &replayed };
+	std::uint32_t		bricks[2], points[2];
+	std::int32_t		lives[2];
+	DirectX::XMFLOAT2	paddle[2];
+
+	for ( std::uint32_t i = 0; i < 2; ++i ) {
+		auto player = games[i]->GetPlayer();
+
+		bricks[i]	= games[i]->GetBricks()->GetCount();
+		points[i]	= player->Points - player->TempPoints;
+		lives[i]	= static_cast<std::int32_t>( player->TempHealth ) - player->Health;
+		paddle[i]	= player->Position;
+	}
+
+	std::printf( "seed %u, %u ticks recorded, %u replayed\n", replay->GetSeed(), played, replayedTicks );
+	std::printf( "recorded %u bricks left, %u points, %d lives lost, replayed %u bricks left, %u points, %d lives lost\n",
+		bricks[0], points[0], lives[0], bricks[1], points[1], lives[1] );
+
+	if ( replayedTicks != played || bricks[0] != bricks[1] || points[0] != points[1] || lives[0] != lives[1] || paddle[0].x != paddle[1].x ) {
+		std::fprintf( stderr, "The replay ended differently than the recorded game\n" );
+		return 1;
+	}
+
+	std::printf( "replay matches the recorded game\n" );
+	return 0;
+}//CheckReplay()
+
+int main( int argc, char **argv ) {
+	std::vector<std::uint8_t> map = GetDefaultMap();
+
+	std::uint32_t	games	= 64;
+	std::uint32_t	seed	= 1;
+	std::uint32_t	threads	= 0;
+	std::uint32_t	ticks	= BatchMaximumTicks;
+	bool			scaling	= false;
+	bool			rewind	= false;
+	bool			replay	= false;
+	std::string		wave;
+	std::string		root;
+
+	for ( int i = 1; i < argc; ++i ) {
+		std::string option( argv[i] );
+		bool hasValue = i + 1 < argc;
+
+		if ( option == "-level" && hasValue ) {
+			if ( !LoadMap( argv[++i], map ) ) {
+				std::fprintf( stderr, "Could not read the map %s\n", argv[i] );
+				return 1;
+			}
+		} else if ( option == "-games" && hasValue ) {
+			games = static_cast<std::uint32_t>( std::strtoul( argv[++i], nullptr, 10 ) );
+		} else if ( option == "-seed" && hasValue ) {
+			seed = static_cast<std::uint32_t>( std::strtoul( argv[++i], nullptr, 10 ) );
+		} else if ( option == "-threads" && hasValue ) {
+			threads = static_cast<std::uint32_t>( std::strtoul( argv[++i], nullptr, 10 ) );
+		} else if ( option == "-ticks" && hasValue ) {
+			ticks = static_cast<std::uint32_t>( std::strtoul( argv[++i], nullptr, 10 ) );
+		} else if ( option == "-scaling" ) {
+			scaling = true;
+		} else if ( option == "-rewind" ) {
+			rewind = true;
+		} else if ( option == "-replay" ) {
+			replay = true;
+		} else if ( option == "-wav" && i + 2 < argc ) {
+			wave = argv[++i];
+			root = argv[++i];
+		} else {
+			std::fprintf( stderr, "Usage: HeadlessRunner [-level map.bmp] [-games n] [-seed n] [-threads n] [-ticks n] [-scaling]\n" );
+			std::fprintf( stderr, "       HeadlessRunner [-level map.bmp] [-seed n] -wav output.wav <asset folder>\n" );
+			std::fprintf( stderr, "       HeadlessRunner [-level map.bmp] [-seed n] [-ticks n] -rewind\n" );
+			std::fprintf( stderr, "       HeadlessRunner [-level map.bmp] [-ticks n] -replay\n" );
+			return 1;
+		}
+	}
+
+	if ( !wave.empty() ) {
+		return RecordGame( map, seed, wave, root );
+	}
+
+	if ( rewind ) {
+		return MeasureRewind( map, seed, ticks );
+	}
+
+	if ( replay ) {
+		return CheckReplay( map, ticks );
+	}
+
+	BatchSimulator simulator;
+	simulator.SetLevel( map.data(), static_cast<std::uint32_t>( map.size() ) );
+	simulator.SetMaximumTicks( ticks );
+	simulator.SetThreadCount( threads );
+
+	if ( !scaling ) {
+		simulator.Run( seed, games );
+		PrintSummary( simulator.GetSummary(), simulator.GetThreadCount() );
+		return 0;
+	}
+
+	//Doubling up to the hardware threads, the last step is the hardware thread count itself
+	simulator.SetThreadCount();
+	std::uint32_t	hardware	= simulator.GetThreadCount();
+	float			single		= 0.0f;
+
+	std::printf( "%u hardware threads, %u games per run\n", hardware, games );
+	std::printf( "threads      ticks/s   speedup\n" );
+
+	for ( std::uint32_t count = 1; ; count = std::min<std::uint32_t>( count * 2, hardware ) ) {
+		simulator.SetThreadCount( count );
+		simulator.Run( seed, games );
+
+		float throughput = simulator.GetSummary().TicksPerSecond;
+
+		if ( count == 1 ) {
+			single = throughput;
+		}
+
+		std::printf( "%7u %12.0f %8.2fx\n", count, throughput, single > 0.0f ? throughput / single : 0.0f );
+
+		if ( count == hardware ) {
+			break;
+		}
+	}
+
+	return 0;
+}//main()
@@ -0,0 +1,306 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+//NOTE: Offline tool that decodes the sounds of a style once and packs them into a sound bank
+//		(see source/SoundBankFormat.h), converted to the format the game mixes in. The game
+//		maps the bank and plays from it without decoding anything at load time.
+//
+//		SoundBankBuilder <asset folder> <output bank> [sound ...]
+//
+//		Sounds are given the way the style returns them, e.g. Assets\Sounds\BrickHit.wav,
+//		relative to the asset folder. Without any the sounds of BasicStyle are packed.
+//		Reads 8, 16 and 24 bit integer and 32 bit float .wav files. Builds with any C++11
+//		compiler, e.g. g++ -std=c++11 -O2 SoundBankBuilder.cpp -o SoundBankBuilder
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../../source/SoundBankFormat.h"
+
+using namespace WinGame::Audio;
+
+//Has to match BasicStyle
+const char *DefaultSounds[] = {
+	"Assets\\Sounds\\SideHit.wav",
+	"Assets\\Sounds\\BallLost.wav",
+	"Assets\\Sounds\\PlayerHit.wav",
+	"Assets\\Sounds\\BrickHit.wav",
+	"Assets\\Sounds\\BrickBreak.wav",
+	"Assets\\Sounds\\round_end.wav",
+	"Assets\\Sounds\\death.wav",
+	"Assets\\Sounds\\PointsAdd.wav",
+	"Assets\\Sounds\\HealthAdd.wav",
+	"Assets\\Sounds\\NegativeItem.wav",
+	"Assets\\Sounds\\PositiveItem.wav",
+	"Assets\\Sounds\\LaserShot.wav"
+};
+
+struct DecodedSound {
+	std::string					Name;
+	std::uint64_t				NameHash;
+	std::vector<std::int16_t>	Samples;	//Interleaved at SoundBankSampleRate and SoundBankChannelCount
+	std::uint32_t				Offset;
+};//DecodedSound struct
+
+static std::uint32_t ReadUInt( const std::vector<unsigned char> &data, std::size_t offset, std::uint32_t bytes ) {
+	std::uint32_t value = 0;
+
+	for ( std::uint32_t i = 0; i < bytes; ++i ) {
+		value |= static_cast<std::uint32_t>( data[offset + i] ) << ( i * 8 );
+	}
+
+	return value;
+}//ReadUInt()
+
+static float ReadSample( const std::vector<unsigned char> &data, std::size_t offset, std::uint32_t format, std::uint32_t bits ) {
+	switch ( bits ) {
+	case 8:
+		return ( static_cast<float>( data[offset] ) - 128.0f ) / 128.0f;
+
+	case 16:
+		return static_cast<std::int16_t>( ReadUInt( data, offset, 2 ) ) / 32768.0f;
+
+	case 24: {
+		std::int32_t value = static_cast<std::int32_t>( ReadUInt( data, offset, 3 ) << 8 ) >> 8;
+		return value / 8388608.0f;
+	}
+
+	default: {
+		std::uint32_t	bitsValue = ReadUInt( data, offset, 4 );
+		float			value;
+
+		std::memcpy( &value, &bitsValue, sizeof( value ) );
+		return format == 3 ? value : static_cast<std::int32_t>( bitsValue ) / 2147483648.0f;
+	}
+	}
+}//ReadSample()
+
+//Loads a .wav file as float frames with two channels at its own sample rate
+static bool LoadWave( const std::string &filename, std::vector<float> &frames, std::uint32_t &sampleRate ) {
+	std::ifstream file( filename.c_str(), std::ios::binary );
+
+	if ( !file.is_open() ) {
+		return false;
+	}
+
+	std::vector<unsigned char> data( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+
+	if ( data.size() < 12 || std::string( data.begin(), data.begin() + 4 ) != "RIFF" || std::string( data.begin() + 8, data.begin() + 12 ) != "WAVE" ) {
+		return false;
+	}
+
+	std::uint32_t	format			= 0;
+	std::uint32_t	channelCount	= 0;
+	std::uint32_t	bits			= 0;
+	std::size_t		offset			= 12;
+
+	while ( offset + 8 <= data.size() ) {
+		std::string		id( data.begin() + offset, data.begin() + offset + 4 );
+		std::uint32_t	size	= ReadUInt( data, offset + 4, 4 );
+		std::size_t		start	= offset + 8;
+
+		if ( start + size > data.size() ) {
+			return false;
+		}
+
+		if ( id == "fmt " && size >= 16 ) {
+			format			= ReadUInt( data, start, 2 );
+			channelCount	= ReadUInt( data, start + 2, 2 );
+			sampleRate		= ReadUInt( data, start + 4, 4 );
+			bits			= ReadUInt( data, start + 14, 2 );
+
+			//WAVE_FORMAT_EXTENSIBLE keeps the actual format in its sub format GUID
+			if ( format == 0xFFFE && size >= 40 ) {
+				format = ReadUInt( data, start + 24, 2 );
+			}
+
+			bool isInteger	= format == 1 && ( bits == 8 || bits == 16 || bits == 24 || bits == 32 );
+			bool isFloat	= format == 3 && bits == 32;
+
+			if ( ( !isInteger && !isFloat ) || channelCount == 0 || sampleRate == 0 ) {
+				return false;
+			}
+		} else if ( id == "data" && channelCount > 0 ) {
+			std::uint32_t bytesPerSample	= bits / 8;
+			std::uint32_t frameCount		= size / ( bytesPerSample * channelCount );
+
+			frames.resize( frameCount * 2 );
+
+			for ( std::uint32_t i = 0; i < frameCount; ++i ) {
+				std::size_t frame = start + i * bytesPerSample * channelCount;
+
+				//Mono goes to both sides, anything above stereo keeps the front pair
+				frames[i * 2]		= ReadSample( data, frame, format, bits );
+				frames[i * 2 + 1]	= channelCount > 1 ? ReadSample( data, frame + bytesPerSample, format, bits ) : frames[i * 2];
+			}
+
+			return true;
+		}
+
+		offset = start + size + ( size & 1 );
+	}
+
+	return false;
+}//LoadWave()
+
+//Linear interpolation, good enough for short effects recorded at another rate
+static std::vector<std::int16_t> Convert( const std::vector<float> &frames, std::uint32_t sampleRate ) {
+	std::size_t sourceCount	= frames.size() / 2;
+	std::size_t targetCount	= static_cast<std::size_t>( static_cast<std::uint64_t>( sourceCount ) * SoundBankSampleRate / sampleRate );
+	double		step		= static_cast<double>( sampleRate ) / SoundBankSampleRate;
+
+	std::vector<std::int16_t> samples( targetCount * SoundBankChannelCount );
+
+	for ( std::size_t i = 0; i < targetCount; ++i ) {
+		double		position	= i * step;
+		std::size_t	index		= static_cast<std::size_t>( position );
+		std::size_t	next		= std::min<std::size_t>( index + 1, sourceCount - 1 );
+		float		weight		= static_cast<float>( position - index );
+
+		for ( std::size_t channel = 0; channel < SoundBankChannelCount; ++channel ) {
+			float value = frames[index * 2 + channel] * ( 1.0f - weight ) + frames[next * 2 + channel] * weight;
+			value		= std::max<float>( -1.0f, std::min<float>( value, 1.0f ) );
+
+			samples[i * SoundBankChannelCount + channel] = static_cast<std::int16_t>( std::lround( value * 32767.0f ) );
+		}
+	}
+
+	return samples;
+}//Convert()
+
+static void WriteUInt( std::vector<unsigned char> &output, std::uint64_t value, std::uint32_t bytes ) {
+	for ( std::uint32_t i = 0; i < bytes; ++i ) {
+		output.push_back( static_cast<unsigned char>( ( value >> ( i * 8 ) ) & 0xFF ) );
+	}
+}//WriteUInt()
+
+static void Align( std::vector<unsigned char> &output ) {
+	while ( output.size() % SoundBankAlignment != 0 ) {
+		output.push_back( 0 );
+	}
+}//Align()
+
+int main( int argc, char **argv ) {
+	if ( argc < 3 ) {
+		std::fprintf( stderr, "Usage: SoundBankBuilder <asset folder> <output bank> [sound ...]\n" );
+		return 1;
+	}
+
+	std::string					root( argv[1] );
+	std::vector<std::string>	names;
+
+	if ( argc > 3 ) {
+		names.assign( argv + 3, argv + argc );
+	} else {
+		names.assign( std::begin( DefaultSounds ), std::end( DefaultSounds ) );
+	}
+
+	std::vector<DecodedSound> sounds;
+
+	for ( const auto &name : names ) {
+		std::string path = root + "/" + name;
+		std::replace( std::begin( path ), std::end( path ), '\\', '/' );
+
+		std::vector<float>	frames;
+		std::uint32_t		sampleRate = 0;
+
+		if ( !LoadWave( path, frames, sampleRate ) || frames.empty() ) {
+			std::fprintf( stderr, "Could not read %s\n", path.c_str() );
+			return 1;
+		}
+
+		DecodedSound sound;
+		sound.Name		= name;
+		sound.NameHash	= HashSoundName( std::wstring( std::begin( name ), std::end( name ) ).c_str() );
+		sound.Samples	= Convert( frames, sampleRate );
+		sound.Offset	= 0;
+
+		sounds.push_back( sound );
+	}
+
+	//The game looks sounds up with a binary search over the hashes
+	std::sort( std::begin( sounds ), std::end( sounds ), []( const DecodedSound &left, const DecodedSound &right ) {
+		return left.NameHash < right.NameHash;
+	} );
+
+	for ( std::size_t i = 1; i < sounds.size(); ++i ) {
+		if ( sounds[i - 1].NameHash == sounds[i].NameHash ) {
+			std::fprintf( stderr, "%s and %s have the same name hash\n", sounds[i - 1].Name.c_str(), sounds[i].Name.c_str() );
+			return 1;
+		}
+	}
+
+	//Lay the data out behind the header and the entries
+	std::size_t offset = sizeof( SoundBankHeader ) + sounds.size() * sizeof( SoundBankEntry );
+
+	for ( auto &sound : sounds ) {
+		offset			= ( offset + SoundBankAlignment - 1 ) / SoundBankAlignment * SoundBankAlignment;
+		sound.Offset	= static_cast<std::uint32_t>( offset );
+		offset			+= ( sound.Samples.size() + SoundBankChannelCount ) * sizeof( std::int16_t );
+	}
+
+	std::vector<unsigned char> output;
+
+	WriteUInt( output, SoundBankMagic, 4 );
+	WriteUInt( output, SoundBankVersion, 4 );
+	WriteUInt( output, sounds.size(), 4 );
+	WriteUInt( output, SoundBankSampleRate, 4 );
+	WriteUInt( output, SoundBankChannelCount, 2 );
+	WriteUInt( output, 16, 2 );
+	WriteUInt( output, offset - sizeof( SoundBankHeader ) - sounds.size() * sizeof( SoundBankEntry ), 4 );
+
+	for ( const auto &sound : sounds ) {
+		WriteUInt( output, sound.NameHash, 8 );
+		WriteUInt( output, sound.Offset, 4 );
+		WriteUInt( output, sound.Samples.size() / SoundBankChannelCount, 4 );
+	}
+
+	for ( const auto &sound : sounds ) {
+		Align( output );
+
+		for ( auto sample : sound.Samples ) {
+			WriteUInt( output, static_cast<std::uint16_t>( sample ), 2 );
+		}
+
+		//One frame of silence behind every sound
+		WriteUInt( output, 0, SoundBankChannelCount * sizeof( std::int16_t ) );
+	}
+
+	std::ofstream file( argv[2], std::ios::binary | std::ios::trunc );
+	file.write( reinterpret_cast<const char*>( output.data() ), output.size() );
+
+	if ( !file.good() ) {
+		std::fprintf( stderr, "Could not write %s\n", argv[2] );
+		return 1;
+	}
+
+	std::printf( "%u sounds, %u bytes written to %s\n", static_cast<std::uint32_t>( sounds.size() ), static_cast<std::uint32_t>( output.size() ), argv[2] );
+	return 0;
+}//main()
@@ -0,0 +1,151 @@
+/*
+====================================================================
+The MIT License
+
+Break It - Copyright (C) 2013 by Daniel Drywa (daniel@drywa.me)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+and associated documentation files (the "Software"), to deal in the Software without restriction, 
+including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies 
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED 
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE 
+OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+===================================================================
+*/
+
+//NOTE: Fires single balls at up to MaximumSpeed straight into a full row of bricks, far
+//		faster than MaximumBallSubSteps steps of MaximumBallStep can cover in one tick. Every
+//		ball has to end the tick below the row and inside the field, and hit the row if its
+//		straight path gets there without touching a side border first. A ball that passed
+//		through the row or the top border counts as tunneled. Returns 0 if none did.
+//
+//		TunnelingTest [shots] [seed]
+//
+//		Builds on the headless source files, e.g. from this directory
+//		g++ -std=c++14 -O2 -DBREAKIT_HEADLESS -I<DirectXMath>/Inc -I../../source -include pch.h
+//			TunnelingTest.cpp <headless sources of ../../source> -o TunnelingTest
+
+#include "pch.h"
+#include "BallManager.h"
+#include "BrickManager.h"
+#include "Player.h"
+#include "CollisionQueue.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <random>
+
+using namespace BreakIt;
+using namespace BreakIt::Objects;
+using namespace DirectX;
+
+//Row of the brick field the balls are fired at
+const std::int32_t TargetRow = 10;
+
+//Speed range per shot, log uniform, and the longest tick (see MinimumTickRate)
+const float MinimumSpeed	= 1.0e3f;
+const float MaximumSpeed	= 1.0e7f;
+const float MaximumTick		= 0.1f;
+
+//Shots may leave the vertical by up to this angle
+const float MaximumAngle = 1.0f;
+
+int main( int argc, char **argv ) {
+	std::uint32_t	shots	= argc > 1 ? static_cast<std::uint32_t>( std::strtoul( argv[1], nullptr, 10 ) ) : 100000;
+	std::uint32_t	seed	= argc > 2 ? static_cast<std::uint32_t>( std::strtoul( argv[2], nullptr, 10 ) ) : 1;
+
+	BallManager		balls;
+	BrickManager	bricks;
+	CollisionQueue	events;
+
+	balls.Initialize( nullptr, false );
+	bricks.Initialize( nullptr, false );
+
+	Player player( 0.0f, GameFieldHeight - PlayerTextureHeight - 42.0f, nullptr );
+	player.Position.x = GameFieldWidth * 0.5f + SplitterWidth - player.HitBoxSize.x * 0.5f;
+
+	XMFLOAT2 fieldMin, fieldMax;
+	balls.GetFieldBounds( fieldMin, fieldMax );
+
+	auto	origin		= bricks.GetGridOrigin();
+	float	rowBottom	= origin.y + static_cast<float>( TargetRow + 1 ) * ItemHeight;
+	float	playerTop	= XMVectorGetY( player.GetHitBoxTopLeft() );
+
+	std::mt19937							random( seed );
+	std::uniform_real_distribution<float>	unit( 0.0f, 1.0f );
+
+	std::uint32_t	capped		= 0;
+	std::uint32_t	missed		= 0;
+	std::uint32_t	tunneled	= 0;
+	std::uint32_t	escaped		= 0;
+
+	for ( std::uint32_t shot = 0; shot < shots; ++shot ) {
+		//White bricks survive more hits than one tick can deliver
+		bricks.Clear();
+		for ( std::int32_t column = 0; column < BricksWide; ++column ) {
+			bricks.AddBrick(
+				origin.x + static_cast<float>( column ) * ItemWidth,
+				origin.y + static_cast<float>( TargetRow ) * ItemHeight,
+				255, 255, 255
+				);
+		}
+
+		float speed	= MinimumSpeed * std::pow( MaximumSpeed / MinimumSpeed, unit( random ) );
+		float angle	= ( unit( random ) * 2.0f - 1.0f ) * MaximumAngle;
+		float tick	= MaximumTick * ( 0.1f + 0.9f * unit( random ) );
+		float x		= fieldMin.x + ( fieldMax.x - fieldMin.x - BallTextureWidth ) * unit( random );
+		float y		= rowBottom + BallTextureHeight + ( playerTop - rowBottom - 3.0f * BallTextureHeight ) * unit( random );
+
+		balls.Clear();
+		balls.AddBall( x, y, XMFLOAT2( speed * std::sin( angle ), -speed * std::cos( angle ) ) );
+
+		//The row has to be hit if the straight path gets there in this tick without a side border in between
+		auto	start		= XMVectorScale( XMVectorAdd( balls.GetBall( 0 )->GetHitBoxTopLeft(), balls.GetBall( 0 )->GetHitBoxBottomRight() ), 0.5f );
+		float	rise		= XMVectorGetY( start ) - BallHeight * 0.5f - rowBottom;
+		float	arrivalX	= XMVectorGetX( start ) + rise * std::tan( angle );
+		bool	reachesRow	=
+			2.0f * speed * tick * std::cos( angle ) > rise &&
+			arrivalX > fieldMin.x + BallWidth * 0.5f &&
+			arrivalX < fieldMax.x - BallWidth * 0.5f;
+
+		//Same test as the step count in BallManager::Update()
+		if ( std::ceil( 2.0f * speed * tick / MaximumBallStep ) > static_cast<float>( MaximumBallSubSteps ) ) {
+			++capped;
+		}
+
+		events.Reset();
+		balls.Update( &player, &bricks, nullptr, &events, tick, 0.0f );
+
+		if ( events.GetTotal( COLLISION_EVENT::BALL_LOST ) != 0 || balls.GetCount() != 1 ) {
+			++escaped;
+			continue;
+		}
+
+		bool	hitRow	= events.GetTotal( COLLISION_EVENT::BRICK_HIT ) != 0;
+		auto	ball	= balls.GetBall( 0 );
+		auto	center	= XMVectorScale( XMVectorAdd( ball->GetHitBoxTopLeft(), ball->GetHitBoxBottomRight() ), 0.5f );
+		float	centerX	= XMVectorGetX( center );
+		float	centerY	= XMVectorGetY( center );
+
+		if ( centerX < fieldMin.x || centerX > fieldMax.x || centerY < fieldMin.y || centerY > fieldMax.y ) {
+			++escaped;
+		} else if ( centerY < rowBottom ) {
+			++tunneled;
+		} else if ( reachesRow && !hitRow ) {
+			++missed;
+		}
+	}
+
+	std::printf( "%u shots (%u past the step cap), speeds %.0f to %.0f, ticks up to %.2fs\n", shots, capped, MinimumSpeed, MaximumSpeed, MaximumTick );
+	std::printf( "%u escaped the field, %u ended inside or above the row, %u never hit it\n", escaped, tunneled, missed );
+
+	return escaped + tunneled + missed == 0 ? 0 : 1;
+}//main()